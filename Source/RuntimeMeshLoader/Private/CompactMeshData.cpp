@@ -0,0 +1,203 @@
+#include "CompactMeshData.h"
+
+SIZE_T FCompactMeshData::GetAllocatedSize() const
+{
+	return Positions.GetAllocatedSize() + Normals.GetAllocatedSize() + Tangents.GetAllocatedSize()
+		+ UVs.GetAllocatedSize() + HalfUVs.GetAllocatedSize()
+		+ Indices16.GetAllocatedSize() + Indices32.GetAllocatedSize();
+}
+
+FCompactMeshData FCompactMeshData::FromMeshData(const FMeshData& Mesh, bool bHalfUVs)
+{
+	FCompactMeshData Compact;
+	const int32 NumVertices = Mesh.Vertices.Num();
+
+	Compact.Positions.SetNumUninitialized(NumVertices);
+	for (int32 i = 0; i < NumVertices; i++)
+	{
+		Compact.Positions[i] = FVector3f(Mesh.Vertices[i]);
+	}
+
+	if (Mesh.Normals.Num() == NumVertices)
+	{
+		Compact.Normals.SetNumUninitialized(NumVertices);
+		for (int32 i = 0; i < NumVertices; i++)
+		{
+			Compact.Normals[i] = FPackedNormal(FVector3f(Mesh.Normals[i]));
+		}
+	}
+
+	if (Mesh.Tangents.Num() == NumVertices)
+	{
+		Compact.Tangents.SetNumUninitialized(NumVertices);
+		for (int32 i = 0; i < NumVertices; i++)
+		{
+			const FProcMeshTangent& Tangent = Mesh.Tangents[i];
+			Compact.Tangents[i] = FPackedNormal(FVector4f(FVector3f(Tangent.TangentX), Tangent.bFlipTangentY ? -1.0f : 1.0f));
+		}
+	}
+
+	if (Mesh.UVs.Num() == NumVertices)
+	{
+		if (bHalfUVs)
+		{
+			Compact.HalfUVs.SetNumUninitialized(NumVertices);
+			for (int32 i = 0; i < NumVertices; i++)
+			{
+				Compact.HalfUVs[i] = FVector2DHalf(FVector2f(Mesh.UVs[i]));
+			}
+		}
+		else
+		{
+			Compact.UVs.SetNumUninitialized(NumVertices);
+			for (int32 i = 0; i < NumVertices; i++)
+			{
+				Compact.UVs[i] = FVector2f(Mesh.UVs[i]);
+			}
+		}
+	}
+
+	if (NumVertices <= MAX_uint16 + 1)
+	{
+		Compact.Indices16.SetNumUninitialized(Mesh.Triangles.Num());
+		for (int32 i = 0; i < Mesh.Triangles.Num(); i++)
+		{
+			Compact.Indices16[i] = (uint16)Mesh.Triangles[i];
+		}
+	}
+	else
+	{
+		Compact.Indices32.SetNumUninitialized(Mesh.Triangles.Num());
+		for (int32 i = 0; i < Mesh.Triangles.Num(); i++)
+		{
+			Compact.Indices32[i] = (uint32)Mesh.Triangles[i];
+		}
+	}
+
+	return Compact;
+}
+
+void FCompactMeshData::ToMeshData(FMeshData& OutMesh) const
+{
+	const int32 NumVerts = NumVertices();
+
+	OutMesh.Vertices.SetNumUninitialized(NumVerts);
+	for (int32 i = 0; i < NumVerts; i++)
+	{
+		OutMesh.Vertices[i] = FVector(Positions[i]);
+	}
+
+	OutMesh.Normals.SetNumUninitialized(Normals.Num());
+	for (int32 i = 0; i < Normals.Num(); i++)
+	{
+		OutMesh.Normals[i] = FVector(Normals[i].ToFVector3f());
+	}
+
+	OutMesh.Tangents.SetNumUninitialized(Tangents.Num());
+	for (int32 i = 0; i < Tangents.Num(); i++)
+	{
+		const FVector4f Tangent = Tangents[i].ToFVector4f();
+		OutMesh.Tangents[i] = FProcMeshTangent(FVector(Tangent.X, Tangent.Y, Tangent.Z), Tangent.W < 0.0f);
+	}
+
+	OutMesh.UVs.SetNumUninitialized(HalfUVs.Num() > 0 ? HalfUVs.Num() : UVs.Num());
+	for (int32 i = 0; i < HalfUVs.Num(); i++)
+	{
+		OutMesh.UVs[i] = FVector2D(FVector2f(HalfUVs[i]));
+	}
+	for (int32 i = 0; i < UVs.Num(); i++)
+	{
+		OutMesh.UVs[i] = FVector2D(UVs[i]);
+	}
+
+	OutMesh.Attributes = (int32)((Normals.Num() > 0 ? EMeshAttributes::Normals : EMeshAttributes::None)
+		| (OutMesh.UVs.Num() > 0 ? EMeshAttributes::UVs : EMeshAttributes::None)
+		| (Tangents.Num() > 0 ? EMeshAttributes::Tangents : EMeshAttributes::None));
+
+	const int32 NumIdx = NumIndices();
+	OutMesh.Triangles.SetNumUninitialized(NumIdx);
+	for (int32 i = 0; i < NumIdx; i++)
+	{
+		OutMesh.Triangles[i] = (int32)GetIndex(i);
+	}
+}
+
+void FCompactMeshData::ToProcMeshSection(FProcMeshSection& OutSection) const
+{
+	const int32 NumVerts = NumVertices();
+
+	OutSection.Reset();
+	OutSection.ProcVertexBuffer.SetNum(NumVerts);
+	OutSection.SectionLocalBox = FBox(ForceInit);
+	for (int32 i = 0; i < NumVerts; i++)
+	{
+		FProcMeshVertex& Vertex = OutSection.ProcVertexBuffer[i];
+		Vertex.Position = FVector(Positions[i]);
+		OutSection.SectionLocalBox += Vertex.Position;
+
+		if (Normals.Num() > 0)
+		{
+			Vertex.Normal = FVector(Normals[i].ToFVector3f());
+		}
+		if (Tangents.Num() > 0)
+		{
+			const FVector4f Tangent = Tangents[i].ToFVector4f();
+			Vertex.Tangent = FProcMeshTangent(FVector(Tangent.X, Tangent.Y, Tangent.Z), Tangent.W < 0.0f);
+		}
+		if (HalfUVs.Num() > 0)
+		{
+			Vertex.UV0 = FVector2D(FVector2f(HalfUVs[i]));
+		}
+		else if (UVs.Num() > 0)
+		{
+			Vertex.UV0 = FVector2D(UVs[i]);
+		}
+	}
+
+	const int32 NumIdx = NumIndices();
+	OutSection.ProcIndexBuffer.SetNumUninitialized(NumIdx);
+	for (int32 i = 0; i < NumIdx; i++)
+	{
+		OutSection.ProcIndexBuffer[i] = GetIndex(i);
+	}
+}
+
+SIZE_T FCompactReturnData::GetAllocatedSize() const
+{
+	SIZE_T Size = Nodes.GetAllocatedSize();
+	for (const FCompactNodeData& Node : Nodes)
+	{
+		Size += Node.Meshes.GetAllocatedSize();
+		for (const FCompactMeshData& Mesh : Node.Meshes)
+		{
+			Size += Mesh.GetAllocatedSize();
+		}
+	}
+	return Size;
+}
+
+FCompactReturnData FCompactReturnData::FromReturnData(FFinalReturnData&& ReturnData, bool bHalfUVs)
+{
+	FCompactReturnData Compact;
+	Compact.Success = ReturnData.Success;
+	Compact.Memory = ReturnData.Memory;
+	Compact.Nodes.Reserve(ReturnData.Nodes.Num());
+
+	for (FNodeData& Node : ReturnData.Nodes)
+	{
+		FCompactNodeData& CompactNode = Compact.Nodes.AddDefaulted_GetRef();
+		CompactNode.RelativeTransform = Node.RelativeTransformTransform;
+		CompactNode.NodeParentIndex = Node.NodeParentIndex;
+		CompactNode.Meshes.Reserve(Node.Meshes.Num());
+
+		for (FMeshData& Mesh : Node.Meshes)
+		{
+			CompactNode.Meshes.Add(FCompactMeshData::FromMeshData(Mesh, bHalfUVs));
+			// Free each unpacked mesh right away, so the model never exists twice in full
+			Mesh = FMeshData();
+		}
+	}
+
+	ReturnData = FFinalReturnData();
+	return Compact;
+}
@@ -3,11 +3,22 @@
 
 #include "MeshLoader.h"
 #include "RuntimeMeshLoader.h"
+#include "MeshSimplifier.h"
+#include "MeshWelder.h"
+#include "CompactMeshData.h"
+#include "SceneBufferData.h"
+#include "RuntimeMeshHandle.h"
+#include "PlatformFileIOSystem.h"
+#include "ZipBundle.h"
+#include "TexturePrefetchCache.h"
+#include "RuntimeMeshPoolSubsystem.h"
 #include "Interfaces/IPluginManager.h"
 
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
+#include <assimp/ProgressHandler.hpp>
+#include <assimp/cexport.h>
 
 #include "Modules/ModuleManager.h"
 #include "Misc/FileHelper.h"
@@ -20,6 +31,11 @@
 #include "Engine/TextureDefines.h"
 #include "RHI.h"
 #include "RenderCore.h"
+#include "Async/ParallelFor.h"
+#include "Misc/MemStack.h"
+#include "Misc/ScopeExit.h"
+#include "HAL/PlatformFileManager.h"
+#include "Stats/Stats.h"
 
 // TexturePlatformData.h has moved in UE 5.5
 #if WITH_UE_5_5
@@ -33,9 +49,111 @@
 #endif
 #endif
 
-FMeshData ProcessMesh(aiMesh* Mesh, const aiScene* Scene)
+DECLARE_STATS_GROUP(TEXT("RuntimeMeshLoader"), STATGROUP_RuntimeMeshLoader, STATCAT_Advanced);
+DECLARE_MEMORY_STAT(TEXT("In-Flight Import Memory"), STAT_RuntimeMeshLoader_InFlight, STATGROUP_RuntimeMeshLoader);
+DECLARE_MEMORY_STAT(TEXT("Last Load Assimp Scene"), STAT_RuntimeMeshLoader_LastScene, STATGROUP_RuntimeMeshLoader);
+DECLARE_MEMORY_STAT(TEXT("Last Load Converted Data"), STAT_RuntimeMeshLoader_LastConverted, STATGROUP_RuntimeMeshLoader);
+DECLARE_MEMORY_STAT(TEXT("Last Load Textures"), STAT_RuntimeMeshLoader_LastTextures, STATGROUP_RuntimeMeshLoader);
+DECLARE_MEMORY_STAT(TEXT("Last Load Peak Transient"), STAT_RuntimeMeshLoader_LastPeak, STATGROUP_RuntimeMeshLoader);
+
+// Transient memory of the loads in progress, see UMeshLoader::GetInFlightImportMemory
+static std::atomic<int64> InFlightImportBytes{ 0 };
+
+void AddInFlightImportMemory(int64 Bytes)
+{
+	InFlightImportBytes += Bytes;
+	if (Bytes >= 0)
+	{
+		INC_MEMORY_STAT_BY(STAT_RuntimeMeshLoader_InFlight, Bytes);
+	}
+	else
+	{
+		DEC_MEMORY_STAT_BY(STAT_RuntimeMeshLoader_InFlight, -Bytes);
+	}
+}
+
+int64 GetSceneMemory(const Assimp::Importer& Importer, FMeshLoadMemoryReport* OutReport = nullptr)
+{
+	aiMemoryInfo Info;
+	Importer.GetMemoryRequirements(Info);
+	if (OutReport)
+	{
+		OutReport->SceneMeshBytes = Info.meshes;
+		OutReport->SceneTextureBytes = Info.textures;
+	}
+	return Info.total;
+}
+
+int64 GetReturnDataMemory(const FFinalReturnData& ReturnData)
+{
+	int64 Bytes = ReturnData.Nodes.GetAllocatedSize();
+	for (const FNodeData& Node : ReturnData.Nodes)
+	{
+		Bytes += Node.Meshes.GetAllocatedSize();
+		for (const FMeshData& Mesh : Node.Meshes)
+		{
+			Bytes += Mesh.Vertices.GetAllocatedSize() + Mesh.Triangles.GetAllocatedSize() + Mesh.Normals.GetAllocatedSize()
+				+ Mesh.UVs.GetAllocatedSize() + Mesh.Tangents.GetAllocatedSize() + Mesh.LODs.GetAllocatedSize();
+			for (const FMeshLODData& LOD : Mesh.LODs)
+			{
+				Bytes += LOD.Vertices.GetAllocatedSize() + LOD.Triangles.GetAllocatedSize() + LOD.Normals.GetAllocatedSize()
+					+ LOD.UVs.GetAllocatedSize() + LOD.Tangents.GetAllocatedSize();
+			}
+		}
+	}
+	return Bytes;
+}
+
+// Size of a PNG once decoded to BGRA8, read from its IHDR chunk. Returns 0 for other formats.
+// Bundle is the open archive of zipped paths, only the header bytes of the entry are inflated.
+int64 GetDecodedPNGMemory(const FString& Path, const FZipBundle* Bundle)
+{
+	uint8 Header[24];
+	FString ArchivePath, EntryName;
+	if (FZipBundle::SplitPath(Path, ArchivePath, EntryName))
+	{
+		if (!Bundle || !Bundle->ReadEntryPrefix(EntryName, Header, UE_ARRAY_COUNT(Header)))
+		{
+			return 0;
+		}
+	}
+	else
+	{
+		TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*Path));
+		if (!Handle || !Handle->Read(Header, UE_ARRAY_COUNT(Header)))
+		{
+			return 0;
+		}
+	}
+
+	static const uint8 Signature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	if (FMemory::Memcmp(Header, Signature, sizeof(Signature)) != 0 || FMemory::Memcmp(Header + 12, "IHDR", 4) != 0)
+	{
+		return 0;
+	}
+
+	auto ReadBigEndian = [&Header](int32 Offset) { return ((uint32)Header[Offset] << 24) | ((uint32)Header[Offset + 1] << 16) | ((uint32)Header[Offset + 2] << 8) | Header[Offset + 3]; };
+	return (int64)ReadBigEndian(16) * ReadBigEndian(20) * 4;
+}
+
+FMeshData ProcessMesh(aiMesh* Mesh, const aiScene* Scene, EMeshAttributes Attributes)
 {
 	FMeshData MeshData;
+
+	// Unrequested attributes and attributes the mesh does not have stay empty. CreateMeshSection and the other
+	// consumers use constant defaults for them ((0,0,1) normals, (0,0) UVs, (1,0,0) tangents).
+	const bool bNormals = EnumHasAnyFlags(Attributes, EMeshAttributes::Normals) && Mesh->HasNormals();
+	const bool bUVs = EnumHasAnyFlags(Attributes, EMeshAttributes::UVs) && Mesh->HasTextureCoords(0);
+	const bool bTangents = EnumHasAnyFlags(Attributes, EMeshAttributes::Tangents) && Mesh->HasTangentsAndBitangents() && Mesh->HasNormals();
+	MeshData.Attributes = (int32)((bNormals ? EMeshAttributes::Normals : EMeshAttributes::None)
+		| (bUVs ? EMeshAttributes::UVs : EMeshAttributes::None)
+		| (bTangents ? EMeshAttributes::Tangents : EMeshAttributes::None));
+
+	// Every array is allocated once with its final size
+	MeshData.Vertices.SetNumUninitialized(Mesh->mNumVertices);
+	MeshData.Normals.SetNumUninitialized(bNormals ? Mesh->mNumVertices : 0);
+	MeshData.UVs.SetNumUninitialized(bUVs ? Mesh->mNumVertices : 0);
+	MeshData.Tangents.SetNumUninitialized(bTangents ? Mesh->mNumVertices : 0);
 	
 	// Vertices
 	for(unsigned int i = 0; i < Mesh->mNumVertices; i++)
@@ -45,25 +163,20 @@ FMeshData ProcessMesh(aiMesh* Mesh, const aiScene* Scene)
 		Vertex.X = Mesh->mVertices[i].x;
 		Vertex.Y = Mesh->mVertices[i].y;
 		Vertex.Z = Mesh->mVertices[i].z;
-		MeshData.Vertices.Add(Vertex);
+		MeshData.Vertices[i] = Vertex;
 		
 		// Normals
-		if(Mesh->HasNormals())
+		if(bNormals)
 		{
 			FVector Normal;
 			Normal.X = Mesh->mNormals[i].x;
 			Normal.Y = Mesh->mNormals[i].y;
 			Normal.Z = Mesh->mNormals[i].z;
-			MeshData.Normals.Add(Normal);
-		}
-		else 
-		{
-            // Add a default normal if none exists
-            MeshData.Normals.Add(FVector(0.0f, 0.0f, 1.0f));
+			MeshData.Normals[i] = Normal;
 		}
 		
 		// Texture Coordinates
-		if(Mesh->HasTextureCoords(0))  // Check if the mesh contains texture coordinates
+		if(bUVs)
 		{
 			// UVs might need adjusting depending on how the texture looks
 			FVector2D UV;
@@ -78,16 +191,11 @@ FMeshData ProcessMesh(aiMesh* Mesh, const aiScene* Scene)
 			if (UV.Y < 0.0f) UV.Y = 0.0f;
 			if (UV.Y > 1.0f) UV.Y = 1.0f;
 			
-			MeshData.UVs.Add(UV);
-		}
-		else
-		{
-			// If no texture coordinates are available, use a default UV mapping
-			MeshData.UVs.Add(FVector2D(0.0f, 0.0f));
+			MeshData.UVs[i] = UV;
 		}
 		
 		// Tangents
-		if(Mesh->HasTangentsAndBitangents())
+		if(bTangents)
 		{
 			FVector Tangent;
 			Tangent.X = Mesh->mTangents[i].x;
@@ -102,284 +210,1285 @@ FMeshData ProcessMesh(aiMesh* Mesh, const aiScene* Scene)
 			// Calculate the handedness value for the tangent by determining the sign of the cross product
 			float TangentW = (FVector::CrossProduct(Tangent, Bitangent).Dot(FVector(Mesh->mNormals[i].x, Mesh->mNormals[i].y, Mesh->mNormals[i].z)) < 0.0f) ? -1.0f : 1.0f;
 			
-			MeshData.Tangents.Add(FProcMeshTangent(Tangent, TangentW < 0.0f));
-		}
-		else
-		{
-			// Add default tangent if none exists
-			MeshData.Tangents.Add(FProcMeshTangent(FVector(1.0f, 0.0f, 0.0f), false));
+			MeshData.Tangents[i] = FProcMeshTangent(Tangent, TangentW < 0.0f);
 		}
 	}
 	
-	// Process indices (faces)
+	// Process indices (faces), point and line faces have fewer than three indices
+	int32 NumIndices = 0;
 	for(unsigned int i = 0; i < Mesh->mNumFaces; i++)
 	{
-		aiFace Face = Mesh->mFaces[i];
+		NumIndices += Mesh->mFaces[i].mNumIndices;
+	}
+
+	MeshData.Triangles.SetNumUninitialized(NumIndices);
+	int32* Index = MeshData.Triangles.GetData();
+	for(unsigned int i = 0; i < Mesh->mNumFaces; i++)
+	{
+		// By reference, copying an aiFace allocates a new index array
+		const aiFace& Face = Mesh->mFaces[i];
 		for(unsigned int j = 0; j < Face.mNumIndices; j++)
 		{
-			MeshData.Triangles.Add(Face.mIndices[j]);
+			*Index++ = Face.mIndices[j];
 		}
 	}
 	
 	return MeshData;
 }
 
-void ProcessNode(aiNode* Node, const aiScene* Scene, int ParentNodeIndex, int* CurrentIndex, FFinalReturnData* FinalReturnData)
+// Converts a mesh straight into the interleaved vertex layout of the procedural mesh component, without the
+// FMeshData arrays in between. Vertices without an attribute keep the FProcMeshVertex defaults, which are the
+// values CreateMeshSection uses.
+void ProcessMeshSection(aiMesh* Mesh, EMeshAttributes Attributes, FProcMeshSection& Section)
 {
-    FNodeData NodeData;
-	NodeData.NodeParentIndex = ParentNodeIndex;
-	
+	const bool bNormals = EnumHasAnyFlags(Attributes, EMeshAttributes::Normals) && Mesh->HasNormals();
+	const bool bUVs = EnumHasAnyFlags(Attributes, EMeshAttributes::UVs) && Mesh->HasTextureCoords(0);
+	const bool bTangents = EnumHasAnyFlags(Attributes, EMeshAttributes::Tangents) && Mesh->HasTangentsAndBitangents() && Mesh->HasNormals();
 
-	aiMatrix4x4 TempTrans = Node->mTransformation;
-	FMatrix tempMatrix;
-	tempMatrix.M[0][0] = TempTrans.a1; tempMatrix.M[0][1] = TempTrans.b1; tempMatrix.M[0][2] = TempTrans.c1; tempMatrix.M[0][3] = TempTrans.d1;
-	tempMatrix.M[1][0] = TempTrans.a2; tempMatrix.M[1][1] = TempTrans.b2; tempMatrix.M[1][2] = TempTrans.c2; tempMatrix.M[1][3] = TempTrans.d2;
-	tempMatrix.M[2][0] = TempTrans.a3; tempMatrix.M[2][1] = TempTrans.b3; tempMatrix.M[2][2] = TempTrans.c3; tempMatrix.M[2][3] = TempTrans.d3;
-	tempMatrix.M[3][0] = TempTrans.a4; tempMatrix.M[3][1] = TempTrans.b4; tempMatrix.M[3][2] = TempTrans.c4; tempMatrix.M[3][3] = TempTrans.d4;
-	NodeData.RelativeTransformTransform = FTransform(tempMatrix);
+	Section.ProcVertexBuffer.SetNum(Mesh->mNumVertices);
+	Section.SectionLocalBox = FBox(ForceInit);
+	for(unsigned int i = 0; i < Mesh->mNumVertices; i++)
+	{
+		FProcMeshVertex& Vertex = Section.ProcVertexBuffer[i];
+		Vertex.Position = FVector(Mesh->mVertices[i].x, Mesh->mVertices[i].y, Mesh->mVertices[i].z);
+		Section.SectionLocalBox += Vertex.Position;
 
-    for (uint32 n = 0; n < Node->mNumMeshes; n++)
-    {
-		uint32 MeshIndex = Node->mMeshes[n];
-		UE_LOG(LogTemp, Log, TEXT("Loading Mesh at index: %d"), MeshIndex);
-        aiMesh* Mesh = Scene->mMeshes[MeshIndex];
-		NodeData.Meshes.Add(ProcessMesh(Mesh, Scene));
-    }
+		if(bNormals)
+		{
+			Vertex.Normal = FVector(Mesh->mNormals[i].x, Mesh->mNormals[i].y, Mesh->mNormals[i].z);
+		}
 
-	FinalReturnData->Nodes.Add(NodeData);
+		if(bUVs)
+		{
+			// Same flip and clamp as ProcessMesh
+			Vertex.UV0.X = FMath::Clamp(Mesh->mTextureCoords[0][i].x, 0.0f, 1.0f);
+			Vertex.UV0.Y = FMath::Clamp(1.0f - Mesh->mTextureCoords[0][i].y, 0.0f, 1.0f);
+		}
 
-	UE_LOG(LogTemp, Log, TEXT("mNumMeshes: %d, mNumChildren of Node: %d"), Node->mNumMeshes, Node->mNumChildren);
-	int CurrentParentIndex = *CurrentIndex;
-	for (uint32 n = 0; n < Node->mNumChildren; n++)
-	{
-		(*CurrentIndex)++;
-	    ProcessNode(Node->mChildren[n], Scene, CurrentParentIndex, CurrentIndex, FinalReturnData);
+		if(bTangents)
+		{
+			const FVector Tangent(Mesh->mTangents[i].x, Mesh->mTangents[i].y, Mesh->mTangents[i].z);
+			const FVector Bitangent(Mesh->mBitangents[i].x, Mesh->mBitangents[i].y, Mesh->mBitangents[i].z);
+			Vertex.Tangent = FProcMeshTangent(Tangent, FVector::CrossProduct(Tangent, Bitangent).Dot(Vertex.Normal) < 0.0f);
+		}
 	}
-}
-
-FFinalReturnData UMeshLoader::LoadMeshFromFile(FString FilePath, EPathType type)
-{
-    FFinalReturnData ReturnData;
-	ReturnData.Success = false;
 
-	if (FilePath.IsEmpty())
+	// Only triangles, CreateMeshSection would misread the indices of point and line faces as well
+	int32 NumIndices = 0;
+	for(unsigned int i = 0; i < Mesh->mNumFaces; i++)
 	{
-		UE_LOG(LogRuntimeMeshLoader, Warning, TEXT("Runtime Mesh Loader: filepath is empty.\n"));
-		return ReturnData;
+		NumIndices += Mesh->mFaces[i].mNumIndices == 3 ? 3 : 0;
 	}
 
-	// Check if the Assimp module is properly loaded
-	FRuntimeMeshLoaderModule& Module = FModuleManager::GetModuleChecked<FRuntimeMeshLoaderModule>("RuntimeMeshLoader");
-	if (!Module.DllHandle)
+	Section.ProcIndexBuffer.SetNumUninitialized(NumIndices);
+	uint32* Index = Section.ProcIndexBuffer.GetData();
+	for(unsigned int i = 0; i < Mesh->mNumFaces; i++)
 	{
-		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Assimp DLL not loaded! Mesh loading will fail."));
-		
-		// Try to manually load the DLL from various locations as a last resort
-		FString PluginDir = IPluginManager::Get().FindPlugin("RuntimeMeshLoader")->GetBaseDir();
-		TArray<FString> PossiblePaths;
-		
-		// Add potential DLL locations to check
-		PossiblePaths.Add(FPaths::Combine(PluginDir, TEXT("ThirdParty/assimp/bin/assimp-vc142-mt.dll")));
-		PossiblePaths.Add(FPaths::Combine(PluginDir, TEXT("Binaries/Win64/assimp-vc142-mt.dll")));
-		PossiblePaths.Add(FPaths::Combine(FPaths::ProjectDir(), TEXT("Binaries/Win64/assimp-vc142-mt.dll")));
-		
-		for (const FString& Path : PossiblePaths)
-		{
-			if (FPaths::FileExists(Path))
-			{
-				UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Found Assimp DLL at %s, attempting to load..."), *Path);
-				Module.DllHandle = FPlatformProcess::GetDllHandle(*Path);
-				if (Module.DllHandle)
-				{
-					UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Successfully loaded Assimp DLL from %s"), *Path);
-					break;
-				}
-			}
-		}
-		
-		// Still no DLL loaded? Return with error
-		if (!Module.DllHandle)
+		const aiFace& Face = Mesh->mFaces[i];
+		if(Face.mNumIndices == 3)
 		{
-			UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Could not find or load Assimp DLL from any location. Mesh loading will fail."));
-			return ReturnData;
+			*Index++ = Face.mIndices[0];
+			*Index++ = Face.mIndices[1];
+			*Index++ = Face.mIndices[2];
 		}
 	}
+}
 
-	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Runtime Mesh Loader: Loading mesh from %s"), *FilePath);
+// Nodes picked by FMeshImportOptions::NodeFilter, everything is selected if the filter is empty.
+// Lives on the memory stack of the converting thread, callers need an FMemMark.
+struct FNodeSelection
+{
+	bool bActive = false;
+	// Nodes whose meshes are imported
+	TSet<const aiNode*, DefaultKeyFuncs<const aiNode*>, TMemStackSetAllocator<>> Selected;
+	// Selected nodes and their ancestors
+	TSet<const aiNode*, DefaultKeyFuncs<const aiNode*>, TMemStackSetAllocator<>> Kept;
+	int32 NumSelectedMeshes = 0;
 
-	if(type == EPathType::Relative){
-		FString ProjectContentDir = FPaths::ProjectContentDir();
-		FilePath = FPaths::Combine(ProjectContentDir, FilePath);
-	}
+	bool IsKept(const aiNode* Node) const { return !bActive || Kept.Contains(Node); }
+	bool IsSelected(const aiNode* Node) const { return !bActive || Selected.Contains(Node); }
+};
 
-	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Runtime Mesh Loader: Absolute path is %s"), *FilePath);
+bool SelectNodes(const aiNode* Node, const FString& ParentPath, bool bParentSelected, const TArray<FString>& Filters, FNodeSelection& Selection)
+{
+	const FString Name = UTF8_TO_TCHAR(Node->mName.C_Str());
 
-	if (!FPaths::FileExists(FilePath))
+	// The FBX importer inserts "<Name>_$AssimpFbx$_<Pivot>" helper nodes above pivoted nodes, they are not part of the path
+	FString Path = ParentPath;
+	if (Node->mParent && !Name.Contains(TEXT("$AssimpFbx$")))
 	{
-		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: File does not exist: %s"), *FilePath);
-		return ReturnData;
+		Path = Path.IsEmpty() ? Name : Path + TEXT("/") + Name;
 	}
 
-	// Check for texture files
-	FString BaseName = FPaths::GetBaseFilename(FilePath);
-	FString Directory = FPaths::GetPath(FilePath);
-	
-	FString TexturePath = FPaths::Combine(Directory, BaseName + TEXT("_T.png"));
-	FString NormalPath = FPaths::Combine(Directory, BaseName + TEXT("_N.png"));
-	
-	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Looking for texture at: %s (Exists: %s)"), 
-		*TexturePath, FPaths::FileExists(TexturePath) ? TEXT("Yes") : TEXT("No"));
-	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Looking for normal map at: %s (Exists: %s)"), 
-		*NormalPath, FPaths::FileExists(NormalPath) ? TEXT("Yes") : TEXT("No"));
-
-	// Continue with existing code for loading the mesh
-	try
+	bool bSelected = bParentSelected;
+	for (int32 FilterIdx = 0; FilterIdx < Filters.Num() && !bSelected; FilterIdx++)
 	{
-		Assimp::Importer Importer;
-		
-		// Configure importer for better UV handling
-		Importer.SetPropertyInteger(AI_CONFIG_PP_PTV_NORMALIZE, 1); // Normalize UVs
-		
-		// Modified processing flags to fix texture mapping issues
-		unsigned int Flags = 
-			aiProcess_Triangulate | 		// Convert all shapes to triangles
-			aiProcess_MakeLeftHanded |  	// Convert to UE coordinate system
-			aiProcess_CalcTangentSpace | 	// Create tangents
-			aiProcess_GenSmoothNormals | 	// Generate smooth normals
-			aiProcess_OptimizeMeshes | 		// Join similar meshes
-			aiProcess_ImproveCacheLocality | // Improve memory access for vertices
-			aiProcess_RemoveRedundantMaterials | // Remove duplicate materials
-			aiProcess_FixInfacingNormals;    // Fix normals pointing inward
-			
-		// Don't flip UVs if the texture appears incorrect
-		// aiProcess_FlipUVs |
-		
-		// Load the scene
-		const aiScene* Scene = Importer.ReadFile(TCHAR_TO_ANSI(*FilePath), Flags);
-
-		if (!Scene || !Scene->HasMeshes())
-		{
-			UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Failed to load mesh: %s. Error: %s"), 
-				*FilePath, 
-				UTF8_TO_TCHAR(Importer.GetErrorString()));
-			return ReturnData;
-		}
-
-		int CurrentIndex = 0;
+		const FString& Filter = Filters[FilterIdx];
+		bSelected = Name == Filter || Path == Filter || Path.EndsWith(TEXT("/") + Filter);
+	}
 
-		ProcessNode(Scene->mRootNode, Scene, -1, &CurrentIndex, &ReturnData);
+	bool bKept = bSelected;
+	for (uint32 n = 0; n < Node->mNumChildren; n++)
+	{
+		bKept = SelectNodes(Node->mChildren[n], Path, bSelected, Filters, Selection) || bKept;
+	}
 
-		ReturnData.Success = true;
+	if (bSelected)
+	{
+		Selection.Selected.Add(Node);
+		Selection.NumSelectedMeshes += Node->mNumMeshes;
 	}
-	catch (const std::exception& e)
+	if (bKept)
 	{
-		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Exception while loading mesh: %s. Error: %s"), 
-			*FilePath, 
-			UTF8_TO_TCHAR(e.what()));
+		Selection.Kept.Add(Node);
 	}
-
-	return ReturnData;
+	return bKept;
 }
 
-bool UMeshLoader::DirectoryExists(FString DirectoryPath)
+FNodeSelection SelectNodes(const aiScene* Scene, const TArray<FString>& Filters)
 {
-	return FPaths::DirectoryExists(DirectoryPath);
+	FNodeSelection Selection;
+	Selection.NumSelectedMeshes = Scene->mNumMeshes;
+	if (Filters.Num() > 0 && Scene->mRootNode)
+	{
+		Selection.bActive = true;
+		Selection.NumSelectedMeshes = 0;
+		SelectNodes(Scene->mRootNode, FString(), false, Filters, Selection);
+	}
+	return Selection;
 }
 
-bool UMeshLoader::CreateDirectory(FString DirectoryPath)
+// Deletes meshes of a scene on the Assimp DLL's heap, where they were allocated: each one is swapped into a one-mesh
+// scene created by aiCopyScene and released with aiFreeScene, the empty mesh it came with is left in the scene instead.
+// Mesh indices of the scene stay valid.
+class FSceneMeshDeleter
 {
-    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+public:
+	FSceneMeshDeleter()
+	{
+		TemplateMeshes[0] = &TemplateMesh;
+		Template.mNumMeshes = 1;
+		Template.mMeshes = TemplateMeshes;
+		Template.mRootNode = &TemplateRoot;
+	}
 
-	if (!PlatformFile.DirectoryExists(*DirectoryPath))
+	~FSceneMeshDeleter()
 	{
-	    return PlatformFile.CreateDirectoryTree(*DirectoryPath);
+		// The template only points to members, keep ~aiScene from deleting them
+		Template.mNumMeshes = 0;
+		Template.mMeshes = nullptr;
+		Template.mRootNode = nullptr;
 	}
 
-	return true;
-}
+	void DeleteMesh(const aiScene* Scene, uint32 MeshIndex)
+	{
+		aiScene* Carrier = nullptr;
+		aiCopyScene(&Template, &Carrier);
+		if (Carrier && Carrier->mNumMeshes == 1)
+		{
+			Swap(Carrier->mMeshes[0], Scene->mMeshes[MeshIndex]);
+		}
+		aiFreeScene(Carrier);
+	}
 
-TArray<FString> UMeshLoader::ListFolders(FString DirectoryPath)
-{
-	TArray<FString> Folders;
-	FFileManagerGeneric::Get().FindFilesRecursive(Folders, *DirectoryPath, TEXT("*"), false, true, true);
-	return Folders;
-}
+private:
+	aiScene Template;
+	aiNode TemplateRoot;
+	aiMesh TemplateMesh;
+	aiMesh* TemplateMeshes[1];
+};
 
-UTexture2D* UMeshLoader::LoadTexture2DFromFile(const FString& FullFilePath, bool& IsValid, int32& Width, int32& Height)
+// Deletes the meshes no selected node references before post-processing, so their memory is returned right away
+// and post-processing skips the empty meshes left in their place.
+void CullUnselectedMeshes(const aiScene* Scene, const FNodeSelection& Selection)
 {
-	IsValid = false;
-	UTexture2D* LoadedTexture = nullptr;
+	TBitArray<> Referenced(false, Scene->mNumMeshes);
+	for (const aiNode* Node : Selection.Selected)
+	{
+		for (uint32 n = 0; n < Node->mNumMeshes; n++)
+		{
+			Referenced[Node->mMeshes[n]] = true;
+		}
+	}
 
-	// Check if file exists
-	if (!FPaths::FileExists(FullFilePath))
+	FSceneMeshDeleter Deleter;
+	int32 NumCulled = 0;
+	for (uint32 MeshIdx = 0; MeshIdx < Scene->mNumMeshes; MeshIdx++)
 	{
-		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Texture file not found: %s"), *FullFilePath);
-		return nullptr;
+		if (!Referenced[MeshIdx])
+		{
+			Deleter.DeleteMesh(Scene, MeshIdx);
+			NumCulled++;
+		}
 	}
 
-	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Attempting to load texture from: %s"), *FullFilePath);
+	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Runtime Mesh Loader: Node filter selected %d nodes, culled %d of %d meshes"),
+		Selection.Selected.Num(), NumCulled, Scene->mNumMeshes);
+}
 
-	// Load the compressed bytes
-	TArray<uint8> FileData;
-	if (!FFileHelper::LoadFileToArray(FileData, *FullFilePath))
+// Frees every aiMesh as soon as its last referencing node is converted, so the scene shrinks while the output grows.
+class FSceneMeshReleaser
+{
+public:
+	FSceneMeshReleaser(const aiScene* InScene, const FNodeSelection& Selection)
+		: Scene(InScene)
 	{
-		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Failed to load texture file to array: %s"), *FullFilePath);
-		return nullptr;
+		References.SetNumZeroed(Scene->mNumMeshes);
+		CountReferences(Scene->mRootNode, Selection);
 	}
 
-	// Get an image wrapper for the file type
-	IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
-	// Detect the image type using the file extension
-	EImageFormat DetectedFormat = EImageFormat::Invalid;
-	
-	if (FullFilePath.EndsWith(".png", ESearchCase::IgnoreCase))
+	void OnMeshConverted(uint32 MeshIndex)
 	{
-		DetectedFormat = EImageFormat::PNG;
+		if (--References[MeshIndex] > 0)
+		{
+			return;
+		}
+		Deleter.DeleteMesh(Scene, MeshIndex);
 	}
-	else if (FullFilePath.EndsWith(".jpg", ESearchCase::IgnoreCase) || FullFilePath.EndsWith(".jpeg", ESearchCase::IgnoreCase))
+
+private:
+	void CountReferences(const aiNode* Node, const FNodeSelection& Selection)
 	{
-		DetectedFormat = EImageFormat::JPEG;
+		if (Selection.IsSelected(Node))
+		{
+			for (uint32 n = 0; n < Node->mNumMeshes; n++)
+			{
+				References[Node->mMeshes[n]]++;
+			}
+		}
+		for (uint32 n = 0; n < Node->mNumChildren; n++)
+		{
+			if (Selection.IsKept(Node->mChildren[n]))
+			{
+				CountReferences(Node->mChildren[n], Selection);
+			}
+		}
 	}
-	else if (FullFilePath.EndsWith(".bmp", ESearchCase::IgnoreCase))
+
+	const aiScene* Scene;
+	TArray<int32, TMemStackAllocator<>> References;
+	FSceneMeshDeleter Deleter;
+};
+
+int32 CountNodes(const aiNode* Node)
+{
+	int32 Count = 1;
+	for (uint32 n = 0; n < Node->mNumChildren; n++)
 	{
-		DetectedFormat = EImageFormat::BMP;
+		Count += CountNodes(Node->mChildren[n]);
 	}
+	return Count;
+}
+
+void ProcessNode(aiNode* Node, const aiScene* Scene, int ParentNodeIndex, int* CurrentIndex, FFinalReturnData* FinalReturnData, const FMeshImportOptions& Options, const FNodeSelection& Selection, FSceneMeshReleaser& MeshReleaser, int32& ProcessedMeshes)
+{
+    FNodeData NodeData;
+	NodeData.NodeParentIndex = ParentNodeIndex;
 	
-	if (DetectedFormat == EImageFormat::Invalid)
+
+	aiMatrix4x4 TempTrans = Node->mTransformation;
+	FMatrix tempMatrix;
+	tempMatrix.M[0][0] = TempTrans.a1; tempMatrix.M[0][1] = TempTrans.b1; tempMatrix.M[0][2] = TempTrans.c1; tempMatrix.M[0][3] = TempTrans.d1;
+	tempMatrix.M[1][0] = TempTrans.a2; tempMatrix.M[1][1] = TempTrans.b2; tempMatrix.M[1][2] = TempTrans.c2; tempMatrix.M[1][3] = TempTrans.d2;
+	tempMatrix.M[2][0] = TempTrans.a3; tempMatrix.M[2][1] = TempTrans.b3; tempMatrix.M[2][2] = TempTrans.c3; tempMatrix.M[2][3] = TempTrans.d3;
+	tempMatrix.M[3][0] = TempTrans.a4; tempMatrix.M[3][1] = TempTrans.b4; tempMatrix.M[3][2] = TempTrans.c4; tempMatrix.M[3][3] = TempTrans.d4;
+	NodeData.RelativeTransformTransform = FTransform(tempMatrix);
+
+	NodeData.Meshes.Reserve(Selection.IsSelected(Node) ? Node->mNumMeshes : 0);
+    for (uint32 n = 0; n < Node->mNumMeshes && Selection.IsSelected(Node); n++)
+    {
+		if (Options.IsCancelled())
+		{
+			return;
+		}
+
+		uint32 MeshIndex = Node->mMeshes[n];
+		UE_LOG(LogTemp, Log, TEXT("Loading Mesh at index: %d"), MeshIndex);
+        aiMesh* Mesh = Scene->mMeshes[MeshIndex];
+		NodeData.Meshes.Add(ProcessMesh(Mesh, Scene, Options.GetAttributes()));
+		MeshReleaser.OnMeshConverted(MeshIndex);
+		Options.ReportProgress(EMeshLoadStage::Conversion, (float)++ProcessedMeshes / (float)FMath::Max(Selection.NumSelectedMeshes, 1));
+    }
+
+	FinalReturnData->Nodes.Add(MoveTemp(NodeData));
+
+	UE_LOG(LogTemp, Log, TEXT("mNumMeshes: %d, mNumChildren of Node: %d"), Node->mNumMeshes, Node->mNumChildren);
+	int CurrentParentIndex = *CurrentIndex;
+	for (uint32 n = 0; n < Node->mNumChildren; n++)
 	{
-		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Unsupported texture format for file: %s"), *FullFilePath);
-		return nullptr;
+		if (!Selection.IsKept(Node->mChildren[n]))
+		{
+			continue;
+		}
+		(*CurrentIndex)++;
+		if (Options.IsCancelled())
+		{
+			return;
+		}
+	    ProcessNode(Node->mChildren[n], Scene, CurrentParentIndex, CurrentIndex, FinalReturnData, Options, Selection, MeshReleaser, ProcessedMeshes);
+	}
+}
+
+// Section counterpart of ProcessNode, visits the nodes in the same order. Empty meshes do not get a section,
+// like in URuntimeMeshLoaderHelper::LoadMeshWithTextures.
+void ProcessNodeSections(aiNode* Node, const aiScene* Scene, const FMeshImportOptions& Options, const FNodeSelection& Selection, FSceneMeshReleaser& MeshReleaser, int32& ProcessedMeshes, TArray<FProcMeshSection>& Sections)
+{
+	for (uint32 n = 0; n < Node->mNumMeshes && Selection.IsSelected(Node); n++)
+	{
+		if (Options.IsCancelled())
+		{
+			return;
+		}
+
+		const uint32 MeshIndex = Node->mMeshes[n];
+		aiMesh* Mesh = Scene->mMeshes[MeshIndex];
+		if (Mesh->mNumVertices > 0 && Mesh->mNumFaces > 0)
+		{
+			ProcessMeshSection(Mesh, Options.GetAttributes(), Sections.AddDefaulted_GetRef());
+		}
+		MeshReleaser.OnMeshConverted(MeshIndex);
+		Options.ReportProgress(EMeshLoadStage::Conversion, (float)++ProcessedMeshes / (float)FMath::Max(Selection.NumSelectedMeshes, 1));
 	}
 
-	TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(DetectedFormat);
+	for (uint32 n = 0; n < Node->mNumChildren; n++)
+	{
+		if (Selection.IsKept(Node->mChildren[n]) && !Options.IsCancelled())
+		{
+			ProcessNodeSections(Node->mChildren[n], Scene, Options, Selection, MeshReleaser, ProcessedMeshes, Sections);
+		}
+	}
+}
 
-	if (!ImageWrapper.IsValid())
+void GenerateLODs(FFinalReturnData& ReturnData, const FMeshImportOptions& Options)
+{
+	TArray<FMeshData*> Meshes;
+	for (FNodeData& Node : ReturnData.Nodes)
 	{
-		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Failed to create image wrapper for format: %d"), (int32)DetectedFormat);
-		return nullptr;
+		for (FMeshData& Mesh : Node.Meshes)
+		{
+			if (Mesh.Triangles.Num() / 3 >= Options.LODMinTriangleCount)
+			{
+				Meshes.Add(&Mesh);
+			}
+		}
 	}
 
-	if (!ImageWrapper->SetCompressed(FileData.GetData(), FileData.Num()))
+	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Runtime Mesh Loader: Generating LODs for %d meshes"), Meshes.Num());
+
+	// Meshes are independent, each worker simplifies the LOD chain of one mesh. Large meshes split their levels
+	// over further workers, so a file with a single scan is not limited to one thread
+	ParallelFor(Meshes.Num(), [&Meshes, &Options](int32 Index)
 	{
-		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Failed to set compressed data for image: %s"), *FullFilePath);
-		return nullptr;
+		if (Options.IsCancelled())
+		{
+			return;
+		}
+		FMeshSimplifier::GenerateLODs(*Meshes[Index], Options);
+	});
+}
+
+void WeldVertices(FFinalReturnData& ReturnData, const FMeshImportOptions& Options)
+{
+	TArray<FMeshData*> Meshes;
+	for (FNodeData& Node : ReturnData.Nodes)
+	{
+		for (FMeshData& Mesh : Node.Meshes)
+		{
+			Meshes.Add(&Mesh);
+		}
+	}
+
+	std::atomic<int64> VerticesBefore{ 0 };
+	std::atomic<int64> VerticesRemoved{ 0 };
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Meshes are welded in parallel, large meshes build and query their hash grid in parallel as well
+	ParallelFor(Meshes.Num(), [&Meshes, &Options, &VerticesBefore, &VerticesRemoved](int32 Index)
+	{
+		if (Options.IsCancelled())
+		{
+			return;
+		}
+		VerticesBefore += Meshes[Index]->Vertices.Num();
+		VerticesRemoved += FMeshWelder::WeldVertices(*Meshes[Index], Options);
+	});
+
+	const int64 Before = VerticesBefore.load();
+	const int64 After = Before - VerticesRemoved.load();
+	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Runtime Mesh Loader: Welded %lld vertices into %lld (%.1f%% fewer) in %.1f ms"),
+		Before, After, Before > 0 ? 100.0 * (Before - After) / Before : 0.0, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+// Makes sure the Assimp DLL is loaded, tries a few known locations as a last resort
+bool EnsureAssimpLoaded()
+{
+	FRuntimeMeshLoaderModule& Module = FModuleManager::GetModuleChecked<FRuntimeMeshLoaderModule>("RuntimeMeshLoader");
+	if (Module.DllHandle)
+	{
+		return true;
+	}
+
+	UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Assimp DLL not loaded! Mesh loading will fail."));
+	
+	// Try to manually load the DLL from various locations as a last resort
+	FString PluginDir = IPluginManager::Get().FindPlugin("RuntimeMeshLoader")->GetBaseDir();
+	TArray<FString> PossiblePaths;
+	
+	// Add potential DLL locations to check
+	PossiblePaths.Add(FPaths::Combine(PluginDir, TEXT("ThirdParty/assimp/bin/assimp-vc142-mt.dll")));
+	PossiblePaths.Add(FPaths::Combine(PluginDir, TEXT("Binaries/Win64/assimp-vc142-mt.dll")));
+	PossiblePaths.Add(FPaths::Combine(FPaths::ProjectDir(), TEXT("Binaries/Win64/assimp-vc142-mt.dll")));
+	
+	for (const FString& Path : PossiblePaths)
+	{
+		if (FPaths::FileExists(Path))
+		{
+			UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Found Assimp DLL at %s, attempting to load..."), *Path);
+			Module.DllHandle = FPlatformProcess::GetDllHandle(*Path);
+			if (Module.DllHandle)
+			{
+				UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Successfully loaded Assimp DLL from %s"), *Path);
+				break;
+			}
+		}
+	}
+	
+	// Still no DLL loaded? Return with error
+	if (!Module.DllHandle)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Could not find or load Assimp DLL from any location. Mesh loading will fail."));
+		return false;
+	}
+	return true;
+}
+
+// Forwards Assimp's progress to FMeshImportOptions and asks it to stop once the load is cancelled
+class FMeshImportProgressHandler : public Assimp::ProgressHandler
+{
+public:
+	explicit FMeshImportProgressHandler(const FMeshImportOptions& InOptions)
+		: Options(InOptions)
+	{
+	}
+
+	virtual bool Update(float Percentage) override
+	{
+		return !Options.IsCancelled();
+	}
+
+	virtual void UpdateFileRead(int CurrentStep, int NumberOfSteps) override
+	{
+		Options.ReportProgress(EMeshLoadStage::Parse, NumberOfSteps > 0 ? (float)CurrentStep / (float)NumberOfSteps : 1.0f);
+	}
+
+	virtual void UpdatePostProcess(int CurrentStep, int NumberOfSteps) override
+	{
+		Options.ReportProgress(EMeshLoadStage::PostProcess, NumberOfSteps > 0 ? (float)CurrentStep / (float)NumberOfSteps : 1.0f);
+	}
+
+private:
+	const FMeshImportOptions& Options;
+};
+
+// Importer settings and post-processing flags shared by all load paths.
+// Options has to outlive the importer if it carries a cancellation token or a progress delegate.
+unsigned int ConfigureImporter(Assimp::Importer& Importer, const FMeshImportOptions& Options)
+{
+	// Read the mesh and the files it references through IPlatformFile (pak files, caching layers).
+	// The importer takes ownership, the IO system is allocated on Assimp's heap through its operator new.
+	if (Options.IOBackend != EMeshFileIOBackend::AssimpDefault)
+	{
+		Importer.SetIOHandler(new FPlatformFileIOSystem(Options.IOBackend == EMeshFileIOBackend::MemoryMapped));
+	}
+
+	if (Options.CancellationToken.IsValid() || Options.OnProgress.IsBound())
+	{
+		Importer.SetProgressHandler(new FMeshImportProgressHandler(Options));
+	}
+
+	// Configure importer for better UV handling
+	Importer.SetPropertyInteger(AI_CONFIG_PP_PTV_NORMALIZE, 1); // Normalize UVs
+	
+	// Modified processing flags to fix texture mapping issues
+	unsigned int Flags = 
+		aiProcess_Triangulate | 		// Convert all shapes to triangles
+		aiProcess_MakeLeftHanded |  	// Convert to UE coordinate system
+		aiProcess_CalcTangentSpace | 	// Create tangents
+		aiProcess_GenSmoothNormals | 	// Generate smooth normals
+		aiProcess_OptimizeMeshes | 		// Join similar meshes
+		aiProcess_ImproveCacheLocality | // Improve memory access for vertices
+		aiProcess_RemoveRedundantMaterials | // Remove duplicate materials
+		aiProcess_FixInfacingNormals;    // Fix normals pointing inward
+		
+	// Don't flip UVs if the texture appears incorrect
+	// aiProcess_FlipUVs |
+
+	// Merge bit-identical vertices before ImproveCacheLocality runs, the welding stage after conversion handles the epsilons
+	if (Options.bWeldVertices)
+	{
+		Flags |= aiProcess_JoinIdenticalVertices;
+	}
+
+	// Assimp splits before ImproveCacheLocality runs, so every chunk gets its own cache optimization
+	if (Options.bSplitLargeMeshes)
+	{
+		Importer.SetPropertyInteger(AI_CONFIG_PP_SLM_VERTEX_LIMIT, FMath::Max(Options.SplitVertexLimit, 3));
+		Importer.SetPropertyInteger(AI_CONFIG_PP_SLM_TRIANGLE_LIMIT, FMath::Max(Options.SplitTriangleLimit, 1));
+		Flags |= aiProcess_SplitLargeMeshes;
+	}
+
+	// Strip unrequested attributes right after parsing, so no later step processes or generates them
+	const EMeshAttributes Attributes = Options.GetAttributes();
+	int RemovedComponents = 0;
+	if (!EnumHasAnyFlags(Attributes, EMeshAttributes::Normals))
+	{
+		RemovedComponents |= aiComponent_NORMALS;
+		Flags &= ~(aiProcess_GenSmoothNormals | aiProcess_FixInfacingNormals);
+	}
+	if (!EnumHasAnyFlags(Attributes, EMeshAttributes::UVs))
+	{
+		RemovedComponents |= aiComponent_TEXCOORDS;
+	}
+	if (!EnumHasAnyFlags(Attributes, EMeshAttributes::Tangents))
+	{
+		RemovedComponents |= aiComponent_TANGENTS_AND_BITANGENTS;
+		Flags &= ~aiProcess_CalcTangentSpace;
+	}
+	if (RemovedComponents != 0)
+	{
+		Importer.SetPropertyInteger(AI_CONFIG_PP_RVC_FLAGS, RemovedComponents);
+		Flags |= aiProcess_RemoveComponent;
+	}
+
+	return Flags;
+}
+
+// Post-processes a scene that was parsed without flags. Parsing and post-processing run as separate steps
+// so a cancelled load skips post-processing and frees the parsed scene right away.
+const aiScene* PostProcessScene(Assimp::Importer& Importer, const aiScene* Scene, unsigned int Flags, const FMeshImportOptions& Options, FMeshLoadMemoryReport& Memory)
+{
+	if (Scene)
+	{
+		// Released by ConvertScene, which runs right before the importer frees the scene
+		Memory.ParsedSceneBytes = GetSceneMemory(Importer);
+		AddInFlightImportMemory(Memory.ParsedSceneBytes);
+	}
+
+	if (Scene && Options.NodeFilter.Num() > 0)
+	{
+		FMemMark Mark(FMemStack::Get());
+		CullUnselectedMeshes(Scene, SelectNodes(Scene, Options.NodeFilter));
+	}
+
+	if (Scene && !Options.IsCancelled())
+	{
+		Scene = Importer.ApplyPostProcessing(Flags);
+	}
+
+	if (Scene && Options.IsCancelled())
+	{
+		Importer.FreeScene();
+		return nullptr;
+	}
+	return Scene;
+}
+
+// Source and parsed scene while parsing, or scene and converted data while converting, plus the prefetched textures.
+// HeldSourceBytes is the part of SourceBytes that stays in memory for the whole load (inflated bundle entries).
+int64 EstimatePeakTransientBytes(const FMeshLoadMemoryReport& Memory, const FMeshImportOptions& Options, int64 HeldSourceBytes)
+{
+	return FMath::Max3(Memory.SourceBytes + Memory.ParsedSceneBytes, Memory.SceneBytes + HeldSourceBytes, Memory.ConvertedBytes + Memory.SceneBytes - Memory.SceneMeshBytes + HeldSourceBytes)
+		+ (Options.bPrefetchTextures ? Memory.TextureBytes : 0);
+}
+
+// Converts an imported scene into ReturnData, SourceName is only used for logging.
+// With OutSections the meshes are converted into procedural mesh sections instead and ReturnData only carries the result.
+void ConvertScene(const aiScene* Scene, Assimp::Importer& Importer, const FString& SourceName, const FMeshImportOptions& Options, FFinalReturnData& ReturnData, TArray<FProcMeshSection>* OutSections = nullptr)
+{
+	const int64 InFlightBytes = ReturnData.Memory.ParsedSceneBytes;
+	ON_SCOPE_EXIT
+	{
+		AddInFlightImportMemory(-InFlightBytes);
+	};
+
+	if (Options.IsCancelled())
+	{
+		UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Runtime Mesh Loader: Loading %s was cancelled"), *SourceName);
+		return;
+	}
+
+	if (!Scene || !Scene->HasMeshes())
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Failed to load mesh: %s. Error: %s"), 
+			*SourceName, 
+			UTF8_TO_TCHAR(Importer.GetErrorString()));
+		return;
+	}
+
+	// Temporary conversion data is allocated from this thread's memory stack and released in one step at the end of the load
+	FMemMark Mark(FMemStack::Get());
+
+	// Selected again on the post-processed scene, post-processing may have rebuilt the mesh lists
+	const FNodeSelection Selection = SelectNodes(Scene, Options.NodeFilter);
+	if (!Selection.IsKept(Scene->mRootNode))
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: No node of %s matches the node filter %s"),
+			*SourceName, *FString::Join(Options.NodeFilter, TEXT(", ")));
+		return;
+	}
+
+	FMeshLoadMemoryReport& Memory = ReturnData.Memory;
+	Memory.SceneBytes = GetSceneMemory(Importer, &Memory);
+
+	int CurrentIndex = 0;
+	int32 ProcessedMeshes = 0;
+	ReturnData.Nodes.Reserve(Selection.bActive ? Selection.Kept.Num() : CountNodes(Scene->mRootNode));
+
+	{
+		FSceneMeshReleaser MeshReleaser(Scene, Selection);
+		if (OutSections)
+		{
+			OutSections->Reserve(Selection.NumSelectedMeshes);
+			ProcessNodeSections(Scene->mRootNode, Scene, Options, Selection, MeshReleaser, ProcessedMeshes, *OutSections);
+		}
+		else
+		{
+			ProcessNode(Scene->mRootNode, Scene, -1, &CurrentIndex, &ReturnData, Options, Selection, MeshReleaser, ProcessedMeshes);
+		}
+	}
+
+	// Everything needed is converted, drop the rest of the scene before welding and LOD generation
+	Importer.FreeScene();
+	Scene = nullptr;
+
+	if (OutSections && (Options.bWeldVertices || Options.bGenerateLODs))
+	{
+		UE_LOG(LogRuntimeMeshLoader, Warning, TEXT("Runtime Mesh Loader: Welding and LOD generation are not available when loading %s into sections"), *SourceName);
+	}
+
+	if (!OutSections && Options.bWeldVertices && !Options.IsCancelled())
+	{
+		WeldVertices(ReturnData, Options);
+	}
+
+	if (!OutSections && Options.bGenerateLODs && !Options.IsCancelled())
+	{
+		GenerateLODs(ReturnData, Options);
+	}
+
+	if (Options.IsCancelled())
+	{
+		// Drop everything converted so far instead of handing out a partial mesh
+		UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Runtime Mesh Loader: Loading %s was cancelled"), *SourceName);
+		ReturnData = FFinalReturnData();
+		if (OutSections)
+		{
+			OutSections->Empty();
+		}
+		return;
+	}
+
+	// Meshes are released as they are converted, so only the rest of the scene is held next to the full output
+	Memory.ConvertedBytes = GetReturnDataMemory(ReturnData);
+	if (OutSections)
+	{
+		Memory.ConvertedBytes += OutSections->GetAllocatedSize();
+		for (const FProcMeshSection& Section : *OutSections)
+		{
+			Memory.ConvertedBytes += Section.ProcVertexBuffer.GetAllocatedSize() + Section.ProcIndexBuffer.GetAllocatedSize();
+		}
+	}
+	Memory.PeakTransientBytes = EstimatePeakTransientBytes(Memory, Options, 0);
+
+	SET_MEMORY_STAT(STAT_RuntimeMeshLoader_LastScene, Memory.SceneBytes);
+	SET_MEMORY_STAT(STAT_RuntimeMeshLoader_LastConverted, Memory.ConvertedBytes);
+	SET_MEMORY_STAT(STAT_RuntimeMeshLoader_LastTextures, Memory.TextureBytes);
+	SET_MEMORY_STAT(STAT_RuntimeMeshLoader_LastPeak, Memory.PeakTransientBytes);
+
+	const double MB = 1024.0 * 1024.0;
+	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Runtime Mesh Loader: Memory of %s: scene %.1f MB (parsed %.1f MB), converted %.1f MB, textures %.1f MB, peak ~%.1f MB"),
+		*SourceName, Memory.SceneBytes / MB, Memory.ParsedSceneBytes / MB, Memory.ConvertedBytes / MB, Memory.TextureBytes / MB, Memory.PeakTransientBytes / MB);
+
+	ReturnData.Success = true;
+}
+
+FFinalReturnData UMeshLoader::LoadMeshFromFile(FString FilePath, EPathType type)
+{
+	return LoadMeshFromFileWithOptions(FilePath, type, FMeshImportOptions());
+}
+
+// Shared by LoadMeshFromFileWithOptions and LoadMeshSectionsFromFile, see ConvertScene for OutSections
+FFinalReturnData LoadMeshFromFileInternal(FString FilePath, EPathType type, const FMeshImportOptions& Options, TArray<FProcMeshSection>* OutSections)
+{
+    FFinalReturnData ReturnData;
+	ReturnData.Success = false;
+
+	if (FilePath.IsEmpty())
+	{
+		UE_LOG(LogRuntimeMeshLoader, Warning, TEXT("Runtime Mesh Loader: filepath is empty.\n"));
+		return ReturnData;
+	}
+
+	// Check if the Assimp module is properly loaded
+	if (!EnsureAssimpLoaded())
+	{
+		return ReturnData;
+	}
+
+	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Runtime Mesh Loader: Loading mesh from %s"), *FilePath);
+
+	if(type == EPathType::Relative){
+		FString ProjectContentDir = FPaths::ProjectContentDir();
+		FilePath = FPaths::Combine(ProjectContentDir, FilePath);
+	}
+
+	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Runtime Mesh Loader: Absolute path is %s"), *FilePath);
+
+	// Paths like "bundle.zip/model.fbx" are read from the archive without extracting it
+	TSharedPtr<FZipBundle> Bundle;
+	FString ArchivePath, EntryName;
+	if (FZipBundle::SplitPath(FilePath, ArchivePath, EntryName))
+	{
+		Bundle = FZipBundle::Open(ArchivePath);
+	}
+
+	auto FileExists = [&Bundle](const FString& Path)
+	{
+		FString PathArchive, PathEntry;
+		return Bundle && FZipBundle::SplitPath(Path, PathArchive, PathEntry) ? Bundle->Contains(PathEntry) : FPaths::FileExists(Path);
+	};
+
+	if (!FileExists(FilePath))
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: File does not exist: %s"), *FilePath);
+		return ReturnData;
+	}
+
+	// Check for texture files
+	FString BaseName = FPaths::GetBaseFilename(FilePath);
+	FString Directory = FPaths::GetPath(FilePath);
+	
+	FString TexturePath = FPaths::Combine(Directory, BaseName + TEXT("_T.png"));
+	FString NormalPath = FPaths::Combine(Directory, BaseName + TEXT("_N.png"));
+	
+	const bool bTextureExists = FileExists(TexturePath);
+	const bool bNormalExists = FileExists(NormalPath);
+	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Looking for texture at: %s (Exists: %s)"), 
+		*TexturePath, bTextureExists ? TEXT("Yes") : TEXT("No"));
+	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Looking for normal map at: %s (Exists: %s)"), 
+		*NormalPath, bNormalExists ? TEXT("Yes") : TEXT("No"));
+
+	ReturnData.Memory.SourceBytes = FMath::Max<int64>(FPlatformFileManager::Get().GetPlatformFile().FileSize(*FilePath), 0);
+	ReturnData.Memory.TextureBytes = (bTextureExists ? GetDecodedPNGMemory(TexturePath, Bundle.Get()) : 0) + (bNormalExists ? GetDecodedPNGMemory(NormalPath, Bundle.Get()) : 0);
+
+	// Read and decode the textures on worker threads while Assimp parses the mesh,
+	// LoadTexture2DFromFile picks up the results afterwards
+	if (Options.bPrefetchTextures)
+	{
+		if (bTextureExists)
+		{
+			FTexturePrefetchCache::Get().Prefetch(TexturePath);
+		}
+		if (bNormalExists)
+		{
+			FTexturePrefetchCache::Get().Prefetch(NormalPath);
+		}
+	}
+
+	// Unclaimed prefetched textures only start to expire once the load is over, however long the parse took
+	ON_SCOPE_EXIT
+	{
+		if (Options.bPrefetchTextures)
+		{
+			FTexturePrefetchCache::Get().OnLoadFinished(TexturePath);
+			FTexturePrefetchCache::Get().OnLoadFinished(NormalPath);
+		}
+	};
+
+	// Continue with existing code for loading the mesh
+	try
+	{
+		Assimp::Importer Importer;
+		unsigned int Flags = ConfigureImporter(Importer, Options);
+		if (Bundle)
+		{
+			// Serves the mesh and the files it references from the archive. The model and the files next to it with
+			// the same base name (.mtl, .bin) are inflated in parallel while Assimp starts on the model, other entries
+			// are inflated as Assimp opens them. The _T/_N textures are read by the texture loader, not from this bundle.
+			Bundle->DecompressAsync(Bundle->FindSiblings(EntryName));
+			Importer.SetIOHandler(new FZipArchiveIOSystem(Bundle, Options.IOBackend == EMeshFileIOBackend::MemoryMapped));
+		}
+		
+		// Load the scene, Assimp and FPlatformFileIOSystem expect UTF-8 paths
+		const aiScene* Parsed = Importer.ReadFile(TCHAR_TO_UTF8(*FilePath), 0);
+
+		// Entries Assimp opened stay inflated in the bundle until the load is done, they are the source data of a bundled mesh
+		const int64 BundleBytes = Bundle ? Bundle->GetDecompressedBytes() : 0;
+		AddInFlightImportMemory(BundleBytes);
+		ON_SCOPE_EXIT
+		{
+			AddInFlightImportMemory(-BundleBytes);
+		};
+		if (Bundle)
+		{
+			ReturnData.Memory.SourceBytes = BundleBytes;
+		}
+
+		const aiScene* Scene = PostProcessScene(Importer, Parsed, Flags, Options, ReturnData.Memory);
+		ConvertScene(Scene, Importer, FilePath, Options, ReturnData, OutSections);
+
+		if (Bundle && ReturnData.Success)
+		{
+			ReturnData.Memory.PeakTransientBytes = EstimatePeakTransientBytes(ReturnData.Memory, Options, BundleBytes);
+			SET_MEMORY_STAT(STAT_RuntimeMeshLoader_LastPeak, ReturnData.Memory.PeakTransientBytes);
+		}
+	}
+	catch (const std::exception& e)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Exception while loading mesh: %s. Error: %s"), 
+			*FilePath, 
+			UTF8_TO_TCHAR(e.what()));
+	}
+
+	return ReturnData;
+}
+
+FFinalReturnData UMeshLoader::LoadMeshFromFileWithOptions(FString FilePath, EPathType type, const FMeshImportOptions& Options)
+{
+	return LoadMeshFromFileInternal(FilePath, type, Options, nullptr);
+}
+
+bool UMeshLoader::LoadMeshSectionsFromFile(const FString& FilePath, EPathType type, const FMeshImportOptions& Options, TArray<FProcMeshSection>& OutSections, FMeshLoadMemoryReport* OutMemory)
+{
+	OutSections.Reset();
+	FFinalReturnData ReturnData = LoadMeshFromFileInternal(FilePath, type, Options, &OutSections);
+	if (OutMemory)
+	{
+		*OutMemory = ReturnData.Memory;
+	}
+	if (!ReturnData.Success)
+	{
+		OutSections.Empty();
+	}
+	return ReturnData.Success;
+}
+
+URuntimeMeshHandle* UMeshLoader::LoadMeshHandleFromFile(FString FilePath, EPathType type, const FMeshImportOptions& Options)
+{
+	return URuntimeMeshHandle::Create(LoadMeshFromFileWithOptions(FilePath, type, Options));
+}
+
+FCompactReturnData UMeshLoader::LoadCompactMeshFromFile(const FString& FilePath, EPathType type, const FMeshImportOptions& Options, bool bHalfUVs)
+{
+	FFinalReturnData ReturnData = LoadMeshFromFileWithOptions(FilePath, type, Options);
+	FCompactReturnData Compact = FCompactReturnData::FromReturnData(MoveTemp(ReturnData), bHalfUVs);
+
+	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Runtime Mesh Loader: Compact mesh data of %s takes %.2f MB"), *FilePath, Compact.GetAllocatedSize() / (1024.0 * 1024.0));
+	return Compact;
+}
+
+FSceneBufferData UMeshLoader::LoadSceneBuffersFromFile(const FString& FilePath, EPathType type, const FMeshImportOptions& Options)
+{
+	FFinalReturnData ReturnData = LoadMeshFromFileWithOptions(FilePath, type, Options);
+	FSceneBufferData SceneData = FSceneBufferData::FromReturnData(MoveTemp(ReturnData));
+
+	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Runtime Mesh Loader: Scene buffers of %s hold %d meshes in %.2f MB"), *FilePath, SceneData.Meshes.Num(), SceneData.GetAllocatedSize() / (1024.0 * 1024.0));
+	return SceneData;
+}
+
+FFinalReturnData UMeshLoader::LoadMeshFromMemory(const TArray<uint8>& Buffer, FString FormatHint)
+{
+	return LoadMeshFromMemory(TArrayView<const uint8>(Buffer), FormatHint, FMeshImportOptions());
+}
+
+FFinalReturnData UMeshLoader::LoadMeshFromMemoryWithOptions(const TArray<uint8>& Buffer, FString FormatHint, const FMeshImportOptions& Options)
+{
+	return LoadMeshFromMemory(TArrayView<const uint8>(Buffer), FormatHint, Options);
+}
+
+FFinalReturnData UMeshLoader::LoadMeshFromMemory(TArrayView<const uint8> Buffer, const FString& FormatHint, const FMeshImportOptions& Options)
+{
+	FFinalReturnData ReturnData;
+	ReturnData.Success = false;
+
+	if (Buffer.Num() == 0)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Warning, TEXT("Runtime Mesh Loader: memory buffer is empty.\n"));
+		return ReturnData;
+	}
+
+	if (!EnsureAssimpLoaded())
+	{
+		return ReturnData;
+	}
+
+	// Assimp expects the bare extension ("obj"), accept ".obj" and "model.obj" as well
+	FString Hint = FormatHint.Contains(TEXT(".")) ? FPaths::GetExtension(FormatHint) : FormatHint;
+	const FString SourceName = FString::Printf(TEXT("<memory %d bytes, hint '%s'>"), Buffer.Num(), *Hint);
+
+	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Runtime Mesh Loader: Loading mesh from %s"), *SourceName);
+
+	try
+	{
+		Assimp::Importer Importer;
+		unsigned int Flags = ConfigureImporter(Importer, Options);
+		ReturnData.Memory.SourceBytes = Buffer.Num();
+
+		// The importer reads straight from Buffer through its memory IO system, no copy is made.
+		// Formats that reference external files (OBJ+MTL, glTF+bin) cannot resolve them from memory.
+		const aiScene* Scene = PostProcessScene(Importer, Importer.ReadFileFromMemory(Buffer.GetData(), Buffer.Num(), 0, TCHAR_TO_ANSI(*Hint)), Flags, Options, ReturnData.Memory);
+		ConvertScene(Scene, Importer, SourceName, Options, ReturnData);
+	}
+	catch (const std::exception& e)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Exception while loading mesh: %s. Error: %s"), 
+			*SourceName, 
+			UTF8_TO_TCHAR(e.what()));
+	}
+
+	return ReturnData;
+}
+
+// Reads counts from binary STL and PLY headers, returns false if the file has no usable header
+bool ScanMeshFileHeader(const FString& FilePath, FMeshFileInfo& Info)
+{
+	const FString Extension = FPaths::GetExtension(FilePath).ToLower();
+	if (Extension != TEXT("stl") && Extension != TEXT("ply"))
+	{
+		return false;
+	}
+
+	TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*FilePath));
+	if (!Handle)
+	{
+		return false;
+	}
+	const int64 FileSize = Handle->Size();
+
+	if (Extension == TEXT("stl"))
+	{
+		// Binary STL: 80 byte header, triangle count, 50 bytes per triangle. ASCII STL has no count.
+		uint8 Header[84];
+		if (FileSize < 84 || !Handle->Read(Header, 84))
+		{
+			return false;
+		}
+
+		const uint32 NumTriangles = (uint32)Header[80] | ((uint32)Header[81] << 8) | ((uint32)Header[82] << 16) | ((uint32)Header[83] << 24);
+		if (84 + (int64)NumTriangles * 50 != FileSize)
+		{
+			return false;
+		}
+
+		Info.NumTriangles = NumTriangles;
+		Info.NumVertices = (int64)NumTriangles * 3;
+		Info.NumMeshes = 1;
+		return true;
+	}
+
+	// PLY: the ASCII header up to "end_header" lists the element counts
+	TArray<uint8> Header;
+	Header.SetNumUninitialized((int32)FMath::Min<int64>(FileSize, 64 * 1024));
+	if (!Handle->Read(Header.GetData(), Header.Num()))
+	{
+		return false;
+	}
+
+	const FUTF8ToTCHAR HeaderConverter((const ANSICHAR*)Header.GetData(), Header.Num());
+	const FString HeaderText(HeaderConverter.Length(), HeaderConverter.Get());
+	const int32 HeaderEnd = HeaderText.Find(TEXT("end_header"), ESearchCase::CaseSensitive);
+	if (!HeaderText.StartsWith(TEXT("ply"), ESearchCase::CaseSensitive) || HeaderEnd == INDEX_NONE)
+	{
+		return false;
+	}
+
+	TArray<FString> Lines;
+	HeaderText.Left(HeaderEnd).ParseIntoArrayLines(Lines);
+	for (const FString& Line : Lines)
+	{
+		TArray<FString> Tokens;
+		Line.ParseIntoArrayWS(Tokens);
+		if (Tokens.Num() == 3 && Tokens[0] == TEXT("element"))
+		{
+			if (Tokens[1] == TEXT("vertex"))
+			{
+				Info.NumVertices = FCString::Atoi64(*Tokens[2]);
+			}
+			else if (Tokens[1] == TEXT("face"))
+			{
+				Info.NumTriangles = FCString::Atoi64(*Tokens[2]);
+			}
+		}
+	}
+
+	Info.NumMeshes = Info.NumVertices > 0 ? 1 : 0;
+	return true;
+}
+
+void CollectNodeStats(const aiNode* Node, const aiScene* Scene, const aiMatrix4x4& ParentTransform, FMeshFileInfo& Info)
+{
+	const aiMatrix4x4 Transform = ParentTransform * Node->mTransformation;
+	Info.NumNodes++;
+
+	for (uint32 n = 0; n < Node->mNumMeshes; n++)
+	{
+		const aiMesh* Mesh = Scene->mMeshes[Node->mMeshes[n]];
+		for (uint32 i = 0; i < Mesh->mNumVertices; i++)
+		{
+			// Mirror Z like aiProcess_MakeLeftHanded does for loaded meshes
+			const aiVector3D Position = Transform * Mesh->mVertices[i];
+			Info.Bounds += FVector(Position.x, Position.y, -Position.z);
+		}
+	}
+
+	for (uint32 n = 0; n < Node->mNumChildren; n++)
+	{
+		CollectNodeStats(Node->mChildren[n], Scene, Transform, Info);
+	}
+}
+
+int64 UMeshLoader::GetInFlightImportMemory()
+{
+	return InFlightImportBytes.load();
+}
+
+FMeshFileInfo UMeshLoader::ProbeMeshFile(FString FilePath, EPathType type, bool bComputeBounds)
+{
+	FMeshFileInfo Info;
+
+	if (type == EPathType::Relative)
+	{
+		FilePath = FPaths::Combine(FPaths::ProjectContentDir(), FilePath);
+	}
+
+	FString ArchivePath, EntryName;
+	const bool bInBundle = FZipBundle::SplitPath(FilePath, ArchivePath, EntryName);
+	if (!bInBundle && !FPaths::FileExists(FilePath))
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: File does not exist: %s"), *FilePath);
+		return Info;
+	}
+
+	Info.FileSize = bInBundle ? 0 : IFileManager::Get().FileSize(*FilePath);
+
+	if (!bInBundle && !bComputeBounds && ScanMeshFileHeader(FilePath, Info))
+	{
+		Info.bFromHeaderScan = true;
+		Info.Success = true;
+		return Info;
+	}
+
+	if (!EnsureAssimpLoaded())
+	{
+		return Info;
+	}
+
+	try
+	{
+		const FMeshImportOptions Options;
+		Assimp::Importer Importer;
+		ConfigureImporter(Importer, Options);
+		if (bInBundle)
+		{
+			TSharedPtr<FZipBundle> Bundle = FZipBundle::Open(ArchivePath);
+			if (!Bundle || !Bundle->Contains(EntryName))
+			{
+				UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: File does not exist: %s"), *FilePath);
+				return Info;
+			}
+			Importer.SetIOHandler(new FZipArchiveIOSystem(Bundle, false));
+		}
+
+		// No post-processing, the scene is only parsed
+		const aiScene* Scene = Importer.ReadFile(TCHAR_TO_UTF8(*FilePath), 0);
+		if (!Scene)
+		{
+			UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Failed to probe %s. Error: %s"),
+				*FilePath,
+				UTF8_TO_TCHAR(Importer.GetErrorString()));
+			return Info;
+		}
+
+		Info.NumMeshes = Scene->mNumMeshes;
+		Info.NumMaterials = Scene->mNumMaterials;
+
+		for (uint32 MeshIdx = 0; MeshIdx < Scene->mNumMeshes; MeshIdx++)
+		{
+			const aiMesh* Mesh = Scene->mMeshes[MeshIdx];
+			Info.NumVertices += Mesh->mNumVertices;
+			for (uint32 FaceIdx = 0; FaceIdx < Mesh->mNumFaces; FaceIdx++)
+			{
+				// Polygons become (corners - 2) triangles after triangulation, points and lines are dropped
+				const uint32 NumCorners = Mesh->mFaces[FaceIdx].mNumIndices;
+				Info.NumTriangles += NumCorners >= 3 ? NumCorners - 2 : 0;
+			}
+		}
+
+		for (uint32 MaterialIdx = 0; MaterialIdx < Scene->mNumMaterials; MaterialIdx++)
+		{
+			const aiMaterial* Material = Scene->mMaterials[MaterialIdx];
+			for (int32 TextureType = aiTextureType_NONE + 1; TextureType <= AI_TEXTURE_TYPE_MAX; TextureType++)
+			{
+				for (uint32 TextureIdx = 0; TextureIdx < Material->GetTextureCount((aiTextureType)TextureType); TextureIdx++)
+				{
+					aiString TexturePath;
+					if (Material->GetTexture((aiTextureType)TextureType, TextureIdx, &TexturePath) == AI_SUCCESS)
+					{
+						Info.TextureReferences.AddUnique(UTF8_TO_TCHAR(TexturePath.C_Str()));
+					}
+				}
+			}
+		}
+
+		if (Scene->mRootNode)
+		{
+			CollectNodeStats(Scene->mRootNode, Scene, aiMatrix4x4(), Info);
+		}
+
+		Info.Success = true;
+	}
+	catch (const std::exception& e)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Exception while probing %s. Error: %s"),
+			*FilePath,
+			UTF8_TO_TCHAR(e.what()));
+	}
+
+	return Info;
+}
+
+FMeshIOBenchmarkResult UMeshLoader::BenchmarkFileIO(FString FilePath, EPathType type, int32 Iterations)
+{
+	FMeshIOBenchmarkResult Result;
+
+	if (type == EPathType::Relative)
+	{
+		FilePath = FPaths::Combine(FPaths::ProjectContentDir(), FilePath);
+	}
+
+	if (!EnsureAssimpLoaded() || !FPaths::FileExists(FilePath))
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Cannot benchmark %s"), *FilePath);
+		return Result;
+	}
+
+	Iterations = FMath::Max(Iterations, 1);
+	Result.FileSizeMB = (float)(IFileManager::Get().FileSize(*FilePath) / (1024.0 * 1024.0));
+
+	const EMeshFileIOBackend Backends[] = { EMeshFileIOBackend::AssimpDefault, EMeshFileIOBackend::PlatformFile, EMeshFileIOBackend::MemoryMapped };
+	double TotalSeconds[UE_ARRAY_COUNT(Backends)] = {};
+
+	for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+	{
+		for (int32 BackendIdx = 0; BackendIdx < UE_ARRAY_COUNT(Backends); BackendIdx++)
+		{
+			// Rotate the order every iteration so no backend always runs on a cold or warm page cache
+			const int32 Backend = (BackendIdx + Iteration) % UE_ARRAY_COUNT(Backends);
+
+			FMeshImportOptions Options;
+			Options.IOBackend = Backends[Backend];
+
+			try
+			{
+				Assimp::Importer Importer;
+				ConfigureImporter(Importer, Options);
+
+				// No post-processing, only reading and parsing are measured
+				const double StartTime = FPlatformTime::Seconds();
+				const aiScene* Scene = Importer.ReadFile(TCHAR_TO_UTF8(*FilePath), 0);
+				TotalSeconds[Backend] += FPlatformTime::Seconds() - StartTime;
+
+				if (!Scene)
+				{
+					UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Failed to parse %s. Error: %s"),
+						*FilePath,
+						UTF8_TO_TCHAR(Importer.GetErrorString()));
+					return Result;
+				}
+			}
+			catch (const std::exception& e)
+			{
+				UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Exception while benchmarking %s. Error: %s"),
+					*FilePath,
+					UTF8_TO_TCHAR(e.what()));
+				return Result;
+			}
+		}
+	}
+
+	Result.AssimpDefaultMs = (float)(TotalSeconds[0] * 1000.0 / Iterations);
+	Result.PlatformFileMs = (float)(TotalSeconds[1] * 1000.0 / Iterations);
+	Result.MemoryMappedMs = (float)(TotalSeconds[2] * 1000.0 / Iterations);
+	Result.Success = true;
+
+	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Runtime Mesh Loader: IO benchmark for %s (%.1f MB, %d iterations): AssimpDefault %.1f ms, PlatformFile %.1f ms, MemoryMapped %.1f ms"),
+		*FilePath, Result.FileSizeMB, Iterations, Result.AssimpDefaultMs, Result.PlatformFileMs, Result.MemoryMappedMs);
+
+	return Result;
+}
+
+bool UMeshLoader::DirectoryExists(FString DirectoryPath)
+{
+	return FPaths::DirectoryExists(DirectoryPath);
+}
+
+bool UMeshLoader::CreateDirectory(FString DirectoryPath)
+{
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	if (!PlatformFile.DirectoryExists(*DirectoryPath))
+	{
+	    return PlatformFile.CreateDirectoryTree(*DirectoryPath);
+	}
+
+	return true;
+}
+
+TArray<FString> UMeshLoader::ListFolders(FString DirectoryPath)
+{
+	TArray<FString> Folders;
+	FFileManagerGeneric::Get().FindFilesRecursive(Folders, *DirectoryPath, TEXT("*"), false, true, true);
+	return Folders;
+}
+
+UTexture2D* UMeshLoader::LoadTexture2DFromFile(const FString& FullFilePath, bool& IsValid, int32& Width, int32& Height)
+{
+	IsValid = false;
+	UTexture2D* LoadedTexture = nullptr;
+
+	// Textures next to a mesh are usually decoded already, see FMeshImportOptions::bPrefetchTextures
+	TSharedPtr<FDecodedTexture> Decoded;
+	if (FTexturePrefetchCache::Get().Take(FullFilePath, Decoded))
+	{
+		UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Using prefetched texture: %s"), *FullFilePath);
+	}
+	else
+	{
+		// Check if file exists
+		if (!FZipBundle::FileExists(FullFilePath))
+		{
+			UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Texture file not found: %s"), *FullFilePath);
+			return nullptr;
+		}
+
+		UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Attempting to load texture from: %s"), *FullFilePath);
+		Decoded = FTexturePrefetchCache::Decode(FullFilePath);
 	}
 
-	// Get the raw RGB data
-	TArray<uint8> RawData;
-	if (!ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, RawData))
+	if (!Decoded)
 	{
-		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Failed to get raw image data: %s"), *FullFilePath);
 		return nullptr;
 	}
 
 	// Create the texture
-	Width = ImageWrapper->GetWidth();
-	Height = ImageWrapper->GetHeight();
+	Width = Decoded->Width;
+	Height = Decoded->Height;
 
 	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("Texture dimensions: %d x %d"), Width, Height);
 
-	LoadedTexture = UTexture2D::CreateTransient(Width, Height, PF_B8G8R8A8);
+	// Reuse a released texture of the same size if the pool has one
+	URuntimeMeshPoolSubsystem* Pool = URuntimeMeshPoolSubsystem::Get();
+	LoadedTexture = Pool ? Pool->AcquireTexture(Width, Height, PF_B8G8R8A8) : UTexture2D::CreateTransient(Width, Height, PF_B8G8R8A8);
 
 	if (!LoadedTexture)
 	{
@@ -389,7 +1498,7 @@ UTexture2D* UMeshLoader::LoadTexture2DFromFile(const FString& FullFilePath, bool
 
 	// Lock the texture for mip-level 0
 	void* TextureData = LoadedTexture->GetPlatformData()->Mips[0].BulkData.Lock(LOCK_READ_WRITE);
-	FMemory::Memcpy(TextureData, RawData.GetData(), RawData.Num());
+	FMemory::Memcpy(TextureData, Decoded->Pixels.GetData(), Decoded->Pixels.Num());
 	LoadedTexture->GetPlatformData()->Mips[0].BulkData.Unlock();
 
 	// Update the texture
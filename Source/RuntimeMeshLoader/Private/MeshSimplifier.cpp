@@ -0,0 +1,590 @@
+#include "MeshSimplifier.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	/** Generated LODs per mesh, in addition to the source mesh (LOD0) */
+	constexpr int32 MaxGeneratedLODs = 3;
+
+	/** Meshes from this size on simplify their LODs in parallel instead of as a chain */
+	constexpr int32 ParallelLODMinTriangles = 100000;
+
+	/** Collapse passes before giving up on reaching the target triangle count */
+	constexpr int32 MaxIterations = 100;
+
+	/** Growth of the error threshold per pass, higher values collapse faster but less carefully */
+	constexpr double Aggressiveness = 7.0;
+
+	/** Weight of the planes through open edges, keeps borders and UV seams in place */
+	constexpr double BorderWeight = 1000.0;
+
+	/** Symmetric 4x4 error quadric, stored as its upper triangle */
+	struct FQuadric
+	{
+		double M[10];
+
+		FQuadric()
+		{
+			FMemory::Memzero(M, sizeof(M));
+		}
+
+		/** Quadric of the plane Ax + By + Cz + D = 0 */
+		FQuadric(double A, double B, double C, double D)
+		{
+			M[0] = A * A; M[1] = A * B; M[2] = A * C; M[3] = A * D;
+			M[4] = B * B; M[5] = B * C; M[6] = B * D;
+			M[7] = C * C; M[8] = C * D;
+			M[9] = D * D;
+		}
+
+		FQuadric& operator+=(const FQuadric& Other)
+		{
+			for (int32 i = 0; i < 10; i++)
+			{
+				M[i] += Other.M[i];
+			}
+			return *this;
+		}
+
+		FQuadric operator+(const FQuadric& Other) const
+		{
+			FQuadric Result = *this;
+			Result += Other;
+			return Result;
+		}
+
+		FQuadric operator*(double Scale) const
+		{
+			FQuadric Result = *this;
+			for (int32 i = 0; i < 10; i++)
+			{
+				Result.M[i] *= Scale;
+			}
+			return Result;
+		}
+
+		/** Sum of squared distances of P to all planes of the quadric */
+		double Evaluate(const FVector3d& P) const
+		{
+			return M[0] * P.X * P.X + 2.0 * M[1] * P.X * P.Y + 2.0 * M[2] * P.X * P.Z + 2.0 * M[3] * P.X
+			     + M[4] * P.Y * P.Y + 2.0 * M[5] * P.Y * P.Z + 2.0 * M[6] * P.Y
+			     + M[7] * P.Z * P.Z + 2.0 * M[8] * P.Z
+			     + M[9];
+		}
+	};
+
+	struct FSimplifyVertex
+	{
+		FVector3d Position;
+		FQuadric Quadric;
+		int32 RefStart = 0;
+		int32 RefCount = 0;
+		bool bBorder = false;
+	};
+
+	struct FSimplifyTriangle
+	{
+		int32 V[3];
+		double Error[4];
+		FVector3d Normal;
+		// Bit j set: collapsing edge j keeps V[j], otherwise it keeps V[(j + 1) % 3]
+		uint8 KeepFirstMask = 0;
+		bool bDeleted = false;
+		bool bDirty = false;
+	};
+
+	/** Triangle corner that references a vertex */
+	struct FVertexRef
+	{
+		int32 Triangle;
+		int32 Corner;
+	};
+
+	/**
+	 * Iterative threshold based simplifier (after Sven Forstmann's Fast-Quadric-Mesh-Simplification),
+	 * restricted to half-edge collapses so no new vertices are created.
+	 */
+	class FQuadricSimplifier
+	{
+	public:
+		FQuadricSimplifier(const TArray<FVector>& Positions, const TArray<int32>& Indices)
+		{
+			// Work in a normalized space, the error threshold does not depend on the model scale then
+			const FBox Bounds(Positions);
+			const FVector3d Center = FVector3d(Bounds.GetCenter());
+			const double Scale = 1.0 / FMath::Max((double)Bounds.GetExtent().GetMax(), 1e-8);
+
+			Vertices.SetNum(Positions.Num());
+			for (int32 i = 0; i < Positions.Num(); i++)
+			{
+				Vertices[i].Position = (FVector3d(Positions[i]) - Center) * Scale;
+			}
+
+			Triangles.Reserve(Indices.Num() / 3);
+			for (int32 i = 0; i + 2 < Indices.Num(); i += 3)
+			{
+				const int32 A = Indices[i], B = Indices[i + 1], C = Indices[i + 2];
+				if (!Vertices.IsValidIndex(A) || !Vertices.IsValidIndex(B) || !Vertices.IsValidIndex(C) || A == B || B == C || A == C)
+				{
+					continue;
+				}
+
+				FSimplifyTriangle& Triangle = Triangles.AddDefaulted_GetRef();
+				Triangle.V[0] = A;
+				Triangle.V[1] = B;
+				Triangle.V[2] = C;
+			}
+		}
+
+		void Run(int32 TargetTriangleCount)
+		{
+			const int32 StartCount = Triangles.Num();
+			int32 DeletedTriangles = 0;
+			TArray<uint8> KeepDeleted;
+			TArray<uint8> RemoveDeleted;
+
+			for (int32 Iteration = 0; Iteration < MaxIterations; Iteration++)
+			{
+				if (StartCount - DeletedTriangles <= TargetTriangleCount)
+				{
+					break;
+				}
+
+				// Drop deleted triangles and rebuild the vertex references once in a while
+				if (Iteration % 5 == 0)
+				{
+					UpdateMesh(Iteration);
+				}
+
+				for (FSimplifyTriangle& Triangle : Triangles)
+				{
+					Triangle.bDirty = false;
+				}
+
+				// Edges cheaper than the threshold are collapsed, the threshold grows with each pass
+				const double Threshold = 1e-9 * FMath::Pow(double(Iteration + 3), Aggressiveness);
+
+				for (int32 TriIdx = 0; TriIdx < Triangles.Num(); TriIdx++)
+				{
+					FSimplifyTriangle& Triangle = Triangles[TriIdx];
+					if (Triangle.Error[3] > Threshold || Triangle.bDeleted || Triangle.bDirty)
+					{
+						continue;
+					}
+
+					for (int32 j = 0; j < 3; j++)
+					{
+						if (Triangle.Error[j] >= Threshold)
+						{
+							continue;
+						}
+
+						const bool bKeepFirst = ((Triangle.KeepFirstMask >> j) & 1) != 0;
+						const int32 Keep = bKeepFirst ? Triangle.V[j] : Triangle.V[(j + 1) % 3];
+						const int32 Remove = bKeepFirst ? Triangle.V[(j + 1) % 3] : Triangle.V[j];
+						FSimplifyVertex& KeepVertex = Vertices[Keep];
+						FSimplifyVertex& RemoveVertex = Vertices[Remove];
+
+						KeepDeleted.SetNumZeroed(KeepVertex.RefCount);
+						RemoveDeleted.SetNumZeroed(RemoveVertex.RefCount);
+
+						// Only the triangles around the removed vertex move, reject the collapse if one of them flips
+						MarkSharedTriangles(KeepVertex, Remove, KeepDeleted);
+						if (Flipped(KeepVertex.Position, Keep, RemoveVertex, RemoveDeleted))
+						{
+							continue;
+						}
+
+						KeepVertex.Quadric += RemoveVertex.Quadric;
+
+						const int32 RefStart = Refs.Num();
+						UpdateTriangles(Keep, KeepVertex.RefStart, KeepVertex.RefCount, KeepDeleted, DeletedTriangles);
+						UpdateTriangles(Keep, RemoveVertex.RefStart, RemoveVertex.RefCount, RemoveDeleted, DeletedTriangles);
+						const int32 RefCount = Refs.Num() - RefStart;
+
+						if (RefCount <= KeepVertex.RefCount)
+						{
+							// Fits into the old slot, saves memory
+							if (RefCount > 0)
+							{
+								FMemory::Memmove(&Refs[KeepVertex.RefStart], &Refs[RefStart], RefCount * sizeof(FVertexRef));
+							}
+						}
+						else
+						{
+							KeepVertex.RefStart = RefStart;
+						}
+						KeepVertex.RefCount = RefCount;
+						RemoveVertex.RefCount = 0;
+						break;
+					}
+
+					if (StartCount - DeletedTriangles <= TargetTriangleCount)
+					{
+						break;
+					}
+				}
+			}
+		}
+
+		void GetIndices(TArray<int32>& OutIndices) const
+		{
+			OutIndices.Reset();
+			for (const FSimplifyTriangle& Triangle : Triangles)
+			{
+				if (!Triangle.bDeleted)
+				{
+					OutIndices.Add(Triangle.V[0]);
+					OutIndices.Add(Triangle.V[1]);
+					OutIndices.Add(Triangle.V[2]);
+				}
+			}
+		}
+
+	private:
+		void UpdateMesh(int32 Iteration)
+		{
+			if (Iteration > 0)
+			{
+				Triangles.RemoveAll([](const FSimplifyTriangle& Triangle) { return Triangle.bDeleted; });
+			}
+
+			BuildRefs();
+
+			if (Iteration == 0)
+			{
+				InitQuadrics();
+				for (FSimplifyTriangle& Triangle : Triangles)
+				{
+					UpdateTriangleErrors(Triangle);
+				}
+			}
+		}
+
+		void BuildRefs()
+		{
+			for (FSimplifyVertex& Vertex : Vertices)
+			{
+				Vertex.RefStart = 0;
+				Vertex.RefCount = 0;
+			}
+			for (const FSimplifyTriangle& Triangle : Triangles)
+			{
+				for (int32 j = 0; j < 3; j++)
+				{
+					Vertices[Triangle.V[j]].RefCount++;
+				}
+			}
+
+			int32 RefStart = 0;
+			for (FSimplifyVertex& Vertex : Vertices)
+			{
+				Vertex.RefStart = RefStart;
+				RefStart += Vertex.RefCount;
+				Vertex.RefCount = 0;
+			}
+
+			Refs.SetNumUninitialized(Triangles.Num() * 3);
+			for (int32 TriIdx = 0; TriIdx < Triangles.Num(); TriIdx++)
+			{
+				for (int32 j = 0; j < 3; j++)
+				{
+					FSimplifyVertex& Vertex = Vertices[Triangles[TriIdx].V[j]];
+					Refs[Vertex.RefStart + Vertex.RefCount] = { TriIdx, j };
+					Vertex.RefCount++;
+				}
+			}
+		}
+
+		void InitQuadrics()
+		{
+			for (FSimplifyTriangle& Triangle : Triangles)
+			{
+				const FVector3d& P0 = Vertices[Triangle.V[0]].Position;
+				Triangle.Normal = ComputeNormal(Triangle);
+
+				const FQuadric Plane(Triangle.Normal.X, Triangle.Normal.Y, Triangle.Normal.Z, -Triangle.Normal.Dot(P0));
+				for (int32 j = 0; j < 3; j++)
+				{
+					Vertices[Triangle.V[j]].Quadric += Plane;
+				}
+			}
+
+			// An edge is open if no other triangle around its first vertex contains the second one.
+			// Open edges get a heavily weighted plane perpendicular to the triangle so they stay in place.
+			for (const FSimplifyTriangle& Triangle : Triangles)
+			{
+				for (int32 j = 0; j < 3; j++)
+				{
+					const int32 A = Triangle.V[j];
+					const int32 B = Triangle.V[(j + 1) % 3];
+					const FSimplifyVertex& VertexA = Vertices[A];
+
+					int32 SharedCount = 0;
+					for (int32 k = 0; k < VertexA.RefCount; k++)
+					{
+						const FSimplifyTriangle& Other = Triangles[Refs[VertexA.RefStart + k].Triangle];
+						if (Other.V[0] == B || Other.V[1] == B || Other.V[2] == B)
+						{
+							SharedCount++;
+						}
+					}
+
+					if (SharedCount == 1)
+					{
+						const FVector3d& PA = Vertices[A].Position;
+						const FVector3d Edge = Vertices[B].Position - PA;
+						const FVector3d BorderNormal = Edge.Cross(Triangle.Normal).GetSafeNormal();
+						const FQuadric BorderPlane = FQuadric(BorderNormal.X, BorderNormal.Y, BorderNormal.Z, -BorderNormal.Dot(PA)) * BorderWeight;
+
+						Vertices[A].Quadric += BorderPlane;
+						Vertices[B].Quadric += BorderPlane;
+						Vertices[A].bBorder = true;
+						Vertices[B].bBorder = true;
+					}
+				}
+			}
+		}
+
+		FVector3d ComputeNormal(const FSimplifyTriangle& Triangle) const
+		{
+			const FVector3d& P0 = Vertices[Triangle.V[0]].Position;
+			const FVector3d& P1 = Vertices[Triangle.V[1]].Position;
+			const FVector3d& P2 = Vertices[Triangle.V[2]].Position;
+			return (P1 - P0).Cross(P2 - P0).GetSafeNormal();
+		}
+
+		/** Error of collapsing the edge Id0-Id1 onto the cheaper of its two vertices */
+		double CalculateError(int32 Id0, int32 Id1, bool& bOutKeepFirst) const
+		{
+			const FSimplifyVertex& Vertex0 = Vertices[Id0];
+			const FSimplifyVertex& Vertex1 = Vertices[Id1];
+			const FQuadric Quadric = Vertex0.Quadric + Vertex1.Quadric;
+
+			// A border vertex may absorb an interior one, but never the other way around
+			if (Vertex0.bBorder != Vertex1.bBorder)
+			{
+				bOutKeepFirst = Vertex0.bBorder;
+				return Quadric.Evaluate(bOutKeepFirst ? Vertex0.Position : Vertex1.Position);
+			}
+
+			const double Error0 = Quadric.Evaluate(Vertex0.Position);
+			const double Error1 = Quadric.Evaluate(Vertex1.Position);
+			bOutKeepFirst = Error0 <= Error1;
+			return FMath::Min(Error0, Error1);
+		}
+
+		void UpdateTriangleErrors(FSimplifyTriangle& Triangle) const
+		{
+			Triangle.KeepFirstMask = 0;
+			for (int32 j = 0; j < 3; j++)
+			{
+				bool bKeepFirst = false;
+				Triangle.Error[j] = CalculateError(Triangle.V[j], Triangle.V[(j + 1) % 3], bKeepFirst);
+				Triangle.KeepFirstMask |= bKeepFirst ? (1 << j) : 0;
+			}
+			Triangle.Error[3] = FMath::Min3(Triangle.Error[0], Triangle.Error[1], Triangle.Error[2]);
+		}
+
+		/** Flags the triangles around Vertex that also contain Other, they disappear with the collapse */
+		void MarkSharedTriangles(const FSimplifyVertex& Vertex, int32 Other, TArray<uint8>& OutDeleted) const
+		{
+			for (int32 k = 0; k < Vertex.RefCount; k++)
+			{
+				const FSimplifyTriangle& Triangle = Triangles[Refs[Vertex.RefStart + k].Triangle];
+				if (!Triangle.bDeleted)
+				{
+					OutDeleted[k] = (Triangle.V[0] == Other || Triangle.V[1] == Other || Triangle.V[2] == Other) ? 1 : 0;
+				}
+			}
+		}
+
+		/** Returns true if moving Vertex to P degenerates or flips one of its remaining triangles */
+		bool Flipped(const FVector3d& P, int32 Keep, const FSimplifyVertex& Vertex, TArray<uint8>& OutDeleted) const
+		{
+			for (int32 k = 0; k < Vertex.RefCount; k++)
+			{
+				const FVertexRef& Ref = Refs[Vertex.RefStart + k];
+				const FSimplifyTriangle& Triangle = Triangles[Ref.Triangle];
+				if (Triangle.bDeleted)
+				{
+					continue;
+				}
+
+				const int32 Id1 = Triangle.V[(Ref.Corner + 1) % 3];
+				const int32 Id2 = Triangle.V[(Ref.Corner + 2) % 3];
+				if (Id1 == Keep || Id2 == Keep)
+				{
+					OutDeleted[k] = 1;
+					continue;
+				}
+
+				const FVector3d D1 = (Vertices[Id1].Position - P).GetSafeNormal();
+				const FVector3d D2 = (Vertices[Id2].Position - P).GetSafeNormal();
+				if (FMath::Abs(D1.Dot(D2)) > 0.999)
+				{
+					return true;
+				}
+
+				OutDeleted[k] = 0;
+				if (D1.Cross(D2).GetSafeNormal().Dot(Triangle.Normal) < 0.2)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/** Moves the corners in [RefStart, RefStart + RefCount) to Keep and appends the surviving references */
+		void UpdateTriangles(int32 Keep, int32 RefStart, int32 RefCount, const TArray<uint8>& Deleted, int32& DeletedTriangles)
+		{
+			for (int32 k = 0; k < RefCount; k++)
+			{
+				// Copy, Refs may reallocate below
+				const FVertexRef Ref = Refs[RefStart + k];
+				FSimplifyTriangle& Triangle = Triangles[Ref.Triangle];
+				if (Triangle.bDeleted)
+				{
+					continue;
+				}
+
+				if (Deleted[k])
+				{
+					Triangle.bDeleted = true;
+					DeletedTriangles++;
+					continue;
+				}
+
+				Triangle.V[Ref.Corner] = Keep;
+				Triangle.Normal = ComputeNormal(Triangle);
+				Triangle.bDirty = true;
+				UpdateTriangleErrors(Triangle);
+				Refs.Add(Ref);
+			}
+		}
+
+		TArray<FSimplifyVertex> Vertices;
+		TArray<FSimplifyTriangle> Triangles;
+		TArray<FVertexRef> Refs;
+	};
+}
+
+void FMeshSimplifier::SimplifyIndices(const TArray<FVector>& Positions, const TArray<int32>& Indices, int32 TargetTriangleCount, TArray<int32>& OutIndices)
+{
+	if (Indices.Num() < 3 || TargetTriangleCount >= Indices.Num() / 3)
+	{
+		OutIndices = Indices;
+		return;
+	}
+
+	FQuadricSimplifier Simplifier(Positions, Indices);
+	Simplifier.Run(FMath::Max(TargetTriangleCount, 1));
+	Simplifier.GetIndices(OutIndices);
+}
+
+void FMeshSimplifier::GenerateLODs(FMeshData& Mesh, const FMeshImportOptions& Options)
+{
+	Mesh.LODs.Reset();
+
+	const int32 SourceTriangleCount = Mesh.Triangles.Num() / 3;
+	const int32 NumLODs = FMath::Min(Options.LODReductionRatios.Num(), MaxGeneratedLODs);
+
+	TArray<int32, TInlineAllocator<MaxGeneratedLODs>> TargetTriangleCounts;
+	for (int32 LODIndex = 0; LODIndex < NumLODs; LODIndex++)
+	{
+		const float Ratio = FMath::Clamp(Options.LODReductionRatios[LODIndex], 0.001f, 1.0f);
+		TargetTriangleCounts.Add(FMath::Max(FMath::RoundToInt(SourceTriangleCount * Ratio), 1));
+	}
+
+	TArray<TArray<int32>, TInlineAllocator<MaxGeneratedLODs>> LODIndices;
+	LODIndices.SetNum(NumLODs);
+
+	if (SourceTriangleCount >= ParallelLODMinTriangles)
+	{
+		// A chain would keep a single large scan on one thread. Every level is simplified from the source instead,
+		// which is more work in total but finishes in about the time of the largest reduction.
+		ParallelFor(NumLODs, [&Mesh, &Options, &TargetTriangleCounts, &LODIndices, SourceTriangleCount](int32 LODIndex)
+		{
+			if (TargetTriangleCounts[LODIndex] < SourceTriangleCount && !Options.IsCancelled())
+			{
+				SimplifyIndices(Mesh.Vertices, Mesh.Triangles, TargetTriangleCounts[LODIndex], LODIndices[LODIndex]);
+			}
+		}, EParallelForFlags::Unbalanced);
+	}
+	else
+	{
+		// Each LOD is simplified from the previous one, which is cheaper for the many small meshes of a scene
+		const TArray<int32>* PreviousIndices = &Mesh.Triangles;
+		for (int32 LODIndex = 0; LODIndex < NumLODs; LODIndex++)
+		{
+			if (TargetTriangleCounts[LODIndex] >= PreviousIndices->Num() / 3)
+			{
+				continue;
+			}
+
+			SimplifyIndices(Mesh.Vertices, *PreviousIndices, TargetTriangleCounts[LODIndex], LODIndices[LODIndex]);
+			if (LODIndices[LODIndex].Num() == 0 || LODIndices[LODIndex].Num() >= PreviousIndices->Num())
+			{
+				break;
+			}
+			PreviousIndices = &LODIndices[LODIndex];
+		}
+	}
+
+	// Keep the levels in order as long as each one has fewer triangles than the last one kept
+	int32 PreviousIndexCount = Mesh.Triangles.Num();
+	for (int32 LODIndex = 0; LODIndex < NumLODs; LODIndex++)
+	{
+		if (TargetTriangleCounts[LODIndex] >= PreviousIndexCount / 3)
+		{
+			continue;
+		}
+
+		const TArray<int32>& Indices = LODIndices[LODIndex];
+		if (Indices.Num() == 0 || Indices.Num() >= PreviousIndexCount)
+		{
+			// Nothing left to collapse without flipping triangles or tearing borders
+			break;
+		}
+
+		FMeshLODData& LOD = Mesh.LODs.AddDefaulted_GetRef();
+		BuildLOD(Mesh, Indices, LOD);
+		LOD.ScreenSize = Options.LODScreenSizes.IsValidIndex(LODIndex)
+			? Options.LODScreenSizes[LODIndex]
+			: FMath::Pow(0.5f, (float)(LODIndex + 1));
+		PreviousIndexCount = Indices.Num();
+	}
+}
+
+void FMeshSimplifier::BuildLOD(const FMeshData& Mesh, const TArray<int32>& Indices, FMeshLODData& OutLOD)
+{
+	const bool bHasNormals = Mesh.Normals.Num() == Mesh.Vertices.Num();
+	const bool bHasUVs = Mesh.UVs.Num() == Mesh.Vertices.Num();
+	const bool bHasTangents = Mesh.Tangents.Num() == Mesh.Vertices.Num();
+
+	TArray<int32> Remap;
+	Remap.Init(INDEX_NONE, Mesh.Vertices.Num());
+
+	OutLOD.Triangles.Reset(Indices.Num());
+	for (int32 Index : Indices)
+	{
+		int32& NewIndex = Remap[Index];
+		if (NewIndex == INDEX_NONE)
+		{
+			NewIndex = OutLOD.Vertices.Add(Mesh.Vertices[Index]);
+			if (bHasNormals)
+			{
+				OutLOD.Normals.Add(Mesh.Normals[Index]);
+			}
+			if (bHasUVs)
+			{
+				OutLOD.UVs.Add(Mesh.UVs[Index]);
+			}
+			if (bHasTangents)
+			{
+				OutLOD.Tangents.Add(Mesh.Tangents[Index]);
+			}
+		}
+		OutLOD.Triangles.Add(NewIndex);
+	}
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MeshLoader.h"
+
+/**
+ * Quadric error metric simplifier (Garland & Heckbert) based on half-edge collapses.
+ * Every collapse moves one vertex onto a neighbour, so the simplified mesh only references
+ * source vertices and keeps their normals, UVs and tangents as they are.
+ */
+class FMeshSimplifier
+{
+public:
+	/**
+	 * Reduces an indexed triangle list to roughly TargetTriangleCount triangles.
+	 * OutIndices references the same Positions array as Indices.
+	 */
+	static void SimplifyIndices(const TArray<FVector>& Positions, const TArray<int32>& Indices, int32 TargetTriangleCount, TArray<int32>& OutIndices);
+
+	/**
+	 * Fills Mesh.LODs with the LOD chain requested by Options. Small meshes simplify each LOD from the previous one,
+	 * large ones simplify every LOD from the source in parallel.
+	 */
+	static void GenerateLODs(FMeshData& Mesh, const FMeshImportOptions& Options);
+
+	/** Copies the vertices referenced by Indices into a self-contained LOD */
+	static void BuildLOD(const FMeshData& Mesh, const TArray<int32>& Indices, FMeshLODData& OutLOD);
+};
@@ -0,0 +1,246 @@
+#include "MeshWelder.h"
+#include "Async/ParallelFor.h"
+#include "Misc/MemStack.h"
+
+namespace
+{
+	/** Hash cell size in multiples of the position epsilon, most vertices then only have to look at their own cell */
+	constexpr double CellScale = 16.0;
+
+	/** Vertices per hash shard, shards are built in parallel */
+	constexpr int32 VerticesPerShard = 16384;
+	constexpr int32 MaxShards = 64;
+
+	struct FWeldGrid
+	{
+		double CellSize = 1.0;
+		int32 NumShards = 1;
+		// First vertex of every cell, per shard
+		TArray<TMap<FInt64Vector3, int32>> Shards;
+		// Next vertex in the same cell, in ascending order
+		TArray<int32, TMemStackAllocator<>> Next;
+
+		FInt64Vector3 GetCell(const FVector& Position) const
+		{
+			return FInt64Vector3(
+				FMath::FloorToInt64(Position.X / CellSize),
+				FMath::FloorToInt64(Position.Y / CellSize),
+				FMath::FloorToInt64(Position.Z / CellSize));
+		}
+
+		int32 GetShard(const FInt64Vector3& Cell) const
+		{
+			return (int32)(GetTypeHash(Cell) % (uint32)NumShards);
+		}
+
+		int32 FindFirst(const FInt64Vector3& Cell) const
+		{
+			const int32* First = Shards[GetShard(Cell)].Find(Cell);
+			return First ? *First : INDEX_NONE;
+		}
+	};
+}
+
+int32 FMeshWelder::WeldVertices(FMeshData& Mesh, const FMeshImportOptions& Options)
+{
+	const int32 NumVertices = Mesh.Vertices.Num();
+	if (NumVertices < 2)
+	{
+		return 0;
+	}
+
+	const bool bHasNormals = Mesh.Normals.Num() == NumVertices;
+	const bool bHasUVs = Mesh.UVs.Num() == NumVertices;
+	const bool bHasTangents = Mesh.Tangents.Num() == NumVertices;
+
+	const double PositionEpsilon = FMath::Max((double)Options.WeldPositionEpsilon, UE_DOUBLE_SMALL_NUMBER);
+	const double PositionEpsilonSq = FMath::Square(PositionEpsilon);
+	const double NormalEpsilonSq = FMath::Square((double)Options.WeldNormalEpsilon);
+	const double UVEpsilonSq = FMath::Square((double)Options.WeldUVEpsilon);
+
+	// Working data lives on this thread's memory stack and is released in one step on return
+	FMemMark Mark(FMemStack::Get());
+
+	FWeldGrid Grid;
+	Grid.CellSize = PositionEpsilon * CellScale;
+	Grid.NumShards = FMath::Clamp(NumVertices / VerticesPerShard, 1, MaxShards);
+	Grid.Shards.SetNum(Grid.NumShards);
+	Grid.Next.SetNumUninitialized(NumVertices);
+
+	TArray<FInt64Vector3, TMemStackAllocator<>> Cells;
+	TArray<int32, TMemStackAllocator<>> VertexShards;
+	Cells.SetNumUninitialized(NumVertices);
+	VertexShards.SetNumUninitialized(NumVertices);
+	ParallelFor(NumVertices, [&](int32 v)
+	{
+		Cells[v] = Grid.GetCell(Mesh.Vertices[v]);
+		VertexShards[v] = Grid.GetShard(Cells[v]);
+	});
+
+	// Vertices grouped by shard in ascending order, ShardStart[s]..ShardStart[s + 1] belong to shard s
+	TArray<int32, TMemStackAllocator<>> ShardStart;
+	ShardStart.SetNumZeroed(Grid.NumShards + 1);
+	for (int32 v = 0; v < NumVertices; v++)
+	{
+		ShardStart[VertexShards[v] + 1]++;
+	}
+	for (int32 ShardIdx = 0; ShardIdx < Grid.NumShards; ShardIdx++)
+	{
+		ShardStart[ShardIdx + 1] += ShardStart[ShardIdx];
+	}
+
+	TArray<int32, TMemStackAllocator<>> ShardVertices;
+	ShardVertices.SetNumUninitialized(NumVertices);
+	{
+		TArray<int32, TMemStackAllocator<>> ShardFill(ShardStart.GetData(), Grid.NumShards);
+		for (int32 v = 0; v < NumVertices; v++)
+		{
+			ShardVertices[ShardFill[VertexShards[v]]++] = v;
+		}
+	}
+
+	// Every shard only touches its own map and the Next entries of its own vertices
+	ParallelFor(Grid.NumShards, [&](int32 ShardIdx)
+	{
+		TMap<FInt64Vector3, int32>& Shard = Grid.Shards[ShardIdx];
+		Shard.Reserve(ShardStart[ShardIdx + 1] - ShardStart[ShardIdx]);
+		for (int32 i = ShardStart[ShardIdx + 1] - 1; i >= ShardStart[ShardIdx]; i--)
+		{
+			const int32 v = ShardVertices[i];
+			int32& First = Shard.FindOrAdd(Cells[v], INDEX_NONE);
+			Grid.Next[v] = First;
+			First = v;
+		}
+	});
+
+	auto Matches = [&](int32 A, int32 B)
+	{
+		return FVector::DistSquared(Mesh.Vertices[A], Mesh.Vertices[B]) <= PositionEpsilonSq
+			&& (!bHasNormals || FVector::DistSquared(Mesh.Normals[A], Mesh.Normals[B]) <= NormalEpsilonSq)
+			&& (!bHasUVs || FVector2D::DistSquared(Mesh.UVs[A], Mesh.UVs[B]) <= UVEpsilonSq);
+	};
+
+	// Lowest matching vertex for every vertex, the grid is read-only now
+	TArray<int32, TMemStackAllocator<>> Representative;
+	Representative.SetNumUninitialized(NumVertices);
+	ParallelFor(NumVertices, [&](int32 v)
+	{
+		const FVector& Position = Mesh.Vertices[v];
+		const FInt64Vector3& Cell = Cells[v];
+
+		// Neighbour cells only have to be searched along axes where the vertex is closer than epsilon to the cell border
+		int32 Low[3];
+		int32 High[3];
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			const double Offset = Position[Axis] - (double)Cell[Axis] * Grid.CellSize;
+			Low[Axis] = Offset < PositionEpsilon ? -1 : 0;
+			High[Axis] = Offset > Grid.CellSize - PositionEpsilon ? 1 : 0;
+		}
+
+		int32 Best = v;
+		for (int32 dx = Low[0]; dx <= High[0]; dx++)
+		{
+			for (int32 dy = Low[1]; dy <= High[1]; dy++)
+			{
+				for (int32 dz = Low[2]; dz <= High[2]; dz++)
+				{
+					for (int32 u = Grid.FindFirst(Cell + FInt64Vector3(dx, dy, dz)); u != INDEX_NONE && u < Best; u = Grid.Next[u])
+					{
+						if (Matches(u, v))
+						{
+							Best = u;
+							break;
+						}
+					}
+				}
+			}
+		}
+		Representative[v] = Best;
+	});
+
+	// Representatives always have a lower index, so every chain is resolved by the time it is reached
+	TArray<int32, TMemStackAllocator<>> Remap;
+	Remap.SetNumUninitialized(NumVertices);
+	int32 NumWelded = 0;
+	for (int32 v = 0; v < NumVertices; v++)
+	{
+		const int32 Rep = Representative[v];
+		Remap[v] = Rep == v ? NumWelded++ : Remap[Rep];
+	}
+
+	if (NumWelded == NumVertices)
+	{
+		return 0;
+	}
+
+	// Compact in place, a kept vertex never moves to a higher index
+	TArray<FVector, TMemStackAllocator<>> NormalSums;
+	if (bHasNormals)
+	{
+		NormalSums.SetNumZeroed(NumWelded);
+	}
+	for (int32 v = 0; v < NumVertices; v++)
+	{
+		const int32 NewIdx = Remap[v];
+		if (bHasNormals)
+		{
+			NormalSums[NewIdx] += Mesh.Normals[v];
+		}
+		if (Representative[v] != v)
+		{
+			continue;
+		}
+		Mesh.Vertices[NewIdx] = Mesh.Vertices[v];
+		if (bHasUVs)
+		{
+			Mesh.UVs[NewIdx] = Mesh.UVs[v];
+		}
+		if (bHasTangents)
+		{
+			Mesh.Tangents[NewIdx] = Mesh.Tangents[v];
+		}
+	}
+
+	Mesh.Vertices.SetNum(NumWelded);
+	if (bHasUVs)
+	{
+		Mesh.UVs.SetNum(NumWelded);
+	}
+	if (bHasTangents)
+	{
+		Mesh.Tangents.SetNum(NumWelded);
+	}
+	if (bHasNormals)
+	{
+		Mesh.Normals.SetNum(NumWelded);
+		ParallelFor(NumWelded, [&](int32 v)
+		{
+			Mesh.Normals[v] = NormalSums[v].GetSafeNormal(UE_SMALL_NUMBER, Mesh.Normals[v]);
+			if (bHasTangents)
+			{
+				// Keep the tangent perpendicular to the averaged normal
+				FVector& TangentX = Mesh.Tangents[v].TangentX;
+				TangentX = (TangentX - Mesh.Normals[v] * FVector::DotProduct(TangentX, Mesh.Normals[v])).GetSafeNormal(UE_SMALL_NUMBER, TangentX);
+			}
+		});
+	}
+
+	// Remap the triangles and drop the ones that collapsed
+	int32 NumIndices = 0;
+	for (int32 i = 0; i + 2 < Mesh.Triangles.Num(); i += 3)
+	{
+		const int32 A = Remap[Mesh.Triangles[i]];
+		const int32 B = Remap[Mesh.Triangles[i + 1]];
+		const int32 C = Remap[Mesh.Triangles[i + 2]];
+		if (A != B && B != C && A != C)
+		{
+			Mesh.Triangles[NumIndices++] = A;
+			Mesh.Triangles[NumIndices++] = B;
+			Mesh.Triangles[NumIndices++] = C;
+		}
+	}
+	Mesh.Triangles.SetNum(NumIndices);
+
+	return NumVertices - NumWelded;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MeshLoader.h"
+
+/**
+ * Merges vertices whose position, normal and UV lie within the epsilons of FMeshImportOptions.
+ * Candidates are found through a spatial hash that is built and queried in parallel, the first vertex of every
+ * group is kept and the normals of a group are averaged. Triangles that collapse are removed.
+ */
+class FMeshWelder
+{
+public:
+	/** Welds Mesh in place and returns the number of removed vertices */
+	static int32 WeldVertices(FMeshData& Mesh, const FMeshImportOptions& Options);
+};
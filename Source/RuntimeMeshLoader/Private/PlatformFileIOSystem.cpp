@@ -0,0 +1,249 @@
+#include "PlatformFileIOSystem.h"
+#include "RuntimeMeshLoader.h"
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Misc/Paths.h"
+#include "Async/MappedFileHandle.h"
+
+#if PLATFORM_UNIX || PLATFORM_MAC
+#include <sys/mman.h>
+#endif
+
+#include <assimp/IOStream.hpp>
+
+namespace
+{
+	class FPlatformFileIOStream : public Assimp::IOStream
+	{
+	public:
+		explicit FPlatformFileIOStream(IFileHandle* InHandle)
+			: Handle(InHandle)
+			, Size(InHandle->Size())
+		{
+		}
+
+		virtual size_t Read(void* pvBuffer, size_t pSize, size_t pCount) override
+		{
+			if (pSize == 0 || pCount == 0)
+			{
+				return 0;
+			}
+
+			// Only read whole elements, Assimp expects the number of elements read
+			const int64 Remaining = Size - Handle->Tell();
+			const size_t Count = FMath::Min<size_t>(pCount, Remaining > 0 ? (size_t)Remaining / pSize : 0);
+			if (Count == 0 || !Handle->Read(static_cast<uint8*>(pvBuffer), (int64)(Count * pSize)))
+			{
+				return 0;
+			}
+			return Count;
+		}
+
+		virtual size_t Write(const void* pvBuffer, size_t pSize, size_t pCount) override
+		{
+			return 0;
+		}
+
+		virtual aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override
+		{
+			int64 Position;
+			switch (pOrigin)
+			{
+			case aiOrigin_SET:
+				Position = (int64)pOffset;
+				break;
+			case aiOrigin_CUR:
+				Position = Handle->Tell() + (int64)pOffset;
+				break;
+			case aiOrigin_END:
+				Position = Size - (int64)pOffset;
+				break;
+			default:
+				return aiReturn_FAILURE;
+			}
+
+			if (Position < 0 || Position > Size)
+			{
+				return aiReturn_FAILURE;
+			}
+			return Handle->Seek(Position) ? aiReturn_SUCCESS : aiReturn_FAILURE;
+		}
+
+		virtual size_t Tell() const override
+		{
+			return (size_t)Handle->Tell();
+		}
+
+		virtual size_t FileSize() const override
+		{
+			return (size_t)Size;
+		}
+
+		virtual void Flush() override
+		{
+		}
+
+	private:
+		TUniquePtr<IFileHandle> Handle;
+		int64 Size;
+	};
+
+	class FMappedFileIOStream : public Assimp::IOStream
+	{
+	public:
+		FMappedFileIOStream(IMappedFileHandle* InHandle, IMappedFileRegion* InRegion)
+			: Handle(InHandle)
+			, Region(InRegion)
+			, Data(InRegion->GetMappedPtr())
+			, Size((size_t)InRegion->GetMappedSize())
+			, Position(0)
+		{
+		}
+
+		virtual size_t Read(void* pvBuffer, size_t pSize, size_t pCount) override
+		{
+			if (pSize == 0 || pCount == 0)
+			{
+				return 0;
+			}
+
+			const size_t Count = FMath::Min(pCount, (Size - Position) / pSize);
+			FMemory::Memcpy(pvBuffer, Data + Position, Count * pSize);
+			Position += Count * pSize;
+			return Count;
+		}
+
+		virtual size_t Write(const void* pvBuffer, size_t pSize, size_t pCount) override
+		{
+			return 0;
+		}
+
+		virtual aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override
+		{
+			size_t NewPosition;
+			switch (pOrigin)
+			{
+			case aiOrigin_SET:
+				NewPosition = pOffset;
+				break;
+			case aiOrigin_CUR:
+				NewPosition = Position + pOffset;
+				break;
+			case aiOrigin_END:
+				if (pOffset > Size)
+				{
+					return aiReturn_FAILURE;
+				}
+				NewPosition = Size - pOffset;
+				break;
+			default:
+				return aiReturn_FAILURE;
+			}
+
+			if (NewPosition > Size)
+			{
+				return aiReturn_FAILURE;
+			}
+			Position = NewPosition;
+			return aiReturn_SUCCESS;
+		}
+
+		virtual size_t Tell() const override
+		{
+			return Position;
+		}
+
+		virtual size_t FileSize() const override
+		{
+			return Size;
+		}
+
+		virtual void Flush() override
+		{
+		}
+
+	private:
+		// Declared in this order so the region is unmapped before the file handle is closed
+		TUniquePtr<IMappedFileHandle> Handle;
+		TUniquePtr<IMappedFileRegion> Region;
+		const uint8* Data;
+		size_t Size;
+		size_t Position;
+	};
+}
+
+FPlatformFileIOSystem::FPlatformFileIOSystem(bool bInMemoryMapped)
+	: PlatformFile(FPlatformFileManager::Get().GetPlatformFile())
+	, bMemoryMapped(bInMemoryMapped)
+{
+}
+
+bool FPlatformFileIOSystem::Exists(const char* pFile) const
+{
+	return PlatformFile.FileExists(UTF8_TO_TCHAR(pFile));
+}
+
+char FPlatformFileIOSystem::getOsSeparator() const
+{
+	// UE paths always use forward slashes, IPlatformFile accepts them on every platform
+	return '/';
+}
+
+Assimp::IOStream* FPlatformFileIOSystem::Open(const char* pFile, const char* pMode)
+{
+	if (!pFile || (pMode && (FCStringAnsi::Strchr(pMode, 'w') || FCStringAnsi::Strchr(pMode, 'a'))))
+	{
+		return nullptr;
+	}
+
+	if (bMemoryMapped)
+	{
+		if (Assimp::IOStream* MappedStream = OpenMapped(UTF8_TO_TCHAR(pFile)))
+		{
+			return MappedStream;
+		}
+	}
+
+	IFileHandle* Handle = PlatformFile.OpenRead(UTF8_TO_TCHAR(pFile));
+	if (!Handle)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Verbose, TEXT("Runtime Mesh Loader: Could not open %s"), UTF8_TO_TCHAR(pFile));
+		return nullptr;
+	}
+	return new FPlatformFileIOStream(Handle);
+}
+
+Assimp::IOStream* FPlatformFileIOSystem::OpenMapped(const TCHAR* Filename)
+{
+	TUniquePtr<IMappedFileHandle> Handle(PlatformFile.OpenMapped(Filename));
+	if (!Handle || Handle->GetFileSize() <= 0)
+	{
+		return nullptr;
+	}
+
+	IMappedFileRegion* Region = Handle->MapRegion(0, Handle->GetFileSize());
+	if (!Region)
+	{
+		return nullptr;
+	}
+
+#if PLATFORM_UNIX || PLATFORM_MAC
+	// Importers parse front to back, let the kernel read ahead aggressively and drop pages behind
+	const SIZE_T PageSize = FPlatformMemory::GetConstants().PageSize;
+	const UPTRINT Start = (UPTRINT)Region->GetMappedPtr() & ~(UPTRINT)(PageSize - 1);
+	const UPTRINT End = (UPTRINT)Region->GetMappedPtr() + (UPTRINT)Region->GetMappedSize();
+	madvise((void*)Start, End - Start, MADV_SEQUENTIAL);
+#endif
+
+	return new FMappedFileIOStream(Handle.Release(), Region);
+}
+
+void FPlatformFileIOSystem::Close(Assimp::IOStream* pFile)
+{
+	delete pFile;
+}
+
+bool FPlatformFileIOSystem::ComparePaths(const char* one, const char* second) const
+{
+	return FPaths::IsSamePath(UTF8_TO_TCHAR(one), UTF8_TO_TCHAR(second));
+}
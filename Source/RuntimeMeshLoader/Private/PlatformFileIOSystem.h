@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <assimp/IOSystem.hpp>
+
+class IPlatformFile;
+
+/**
+ * Assimp IO system that reads through UE's IPlatformFile stack instead of fopen,
+ * so pak/IoStore content and file caching layers work for the mesh and for every file it references
+ * (OBJ materials, glTF buffers, external FBX textures...). Paths are UTF-8, as everywhere in Assimp.
+ * Read-only, opening a file for writing fails.
+ *
+ * With bMemoryMapped, files are served from a memory-mapped view instead of buffered reads,
+ * which avoids copying multi-gigabyte files through an intermediate buffer. Files that cannot be
+ * mapped (pak content, platforms without mapping support) are read the buffered way.
+ */
+class FPlatformFileIOSystem : public Assimp::IOSystem
+{
+public:
+	explicit FPlatformFileIOSystem(bool bInMemoryMapped = false);
+
+	virtual bool Exists(const char* pFile) const override;
+	virtual char getOsSeparator() const override;
+	virtual Assimp::IOStream* Open(const char* pFile, const char* pMode = "rb") override;
+	virtual void Close(Assimp::IOStream* pFile) override;
+	virtual bool ComparePaths(const char* one, const char* second) const override;
+
+private:
+	Assimp::IOStream* OpenMapped(const TCHAR* Filename);
+
+	IPlatformFile& PlatformFile;
+	bool bMemoryMapped;
+};
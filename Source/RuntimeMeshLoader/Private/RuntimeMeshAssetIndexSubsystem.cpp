@@ -0,0 +1,602 @@
+#include "RuntimeMeshAssetIndexSubsystem.h"
+#include "RuntimeMeshLoader.h"
+#include "Engine/Engine.h"
+#include "Algo/BinarySearch.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+#if RUNTIME_MESH_LOADER_WITH_DIRECTORY_WATCHER
+#include "DirectoryWatcherModule.h"
+#include "IDirectoryWatcher.h"
+#endif
+
+namespace
+{
+	constexpr int32 ManifestVersion = 1;
+
+	const TCHAR* ModelExtensions[] = { TEXT("fbx"), TEXT("obj"), TEXT("gltf"), TEXT("glb"), TEXT("dae"), TEXT("3ds"), TEXT("stl"), TEXT("ply"), TEXT("blend"), TEXT("x"), TEXT("off") };
+
+	bool IsModelFile(const FString& Path)
+	{
+		const FString Extension = FPaths::GetExtension(Path);
+		for (const TCHAR* ModelExtension : ModelExtensions)
+		{
+			if (Extension.Equals(ModelExtension, ESearchCase::IgnoreCase))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool IsSiblingTexture(const FString& Path)
+	{
+		return Path.EndsWith(TEXT("_T.png")) || Path.EndsWith(TEXT("_N.png"));
+	}
+
+	FString GetSiblingTexturePath(const FString& ModelPath, const TCHAR* Suffix)
+	{
+		return FPaths::GetPath(ModelPath) / (FPaths::GetBaseFilename(ModelPath) + Suffix);
+	}
+
+	FString NormalizePath(const FString& Path)
+	{
+		FString Result = FPaths::ConvertRelativePathToFull(Path);
+		FPaths::NormalizeDirectoryName(Result);
+		return Result;
+	}
+
+	struct FScanResult
+	{
+		TArray<FString> Folders;
+		TArray<FMeshAssetEntry> Models;
+		TSet<FString> Textures;
+
+		bool Visit(const TCHAR* Path, const FFileStatData& StatData)
+		{
+			FString FilePath(Path);
+			if (StatData.bIsDirectory)
+			{
+				Folders.Add(MoveTemp(FilePath));
+			}
+			else if (IsModelFile(FilePath))
+			{
+				FMeshAssetEntry& Entry = Models.AddDefaulted_GetRef();
+				Entry.Path = MoveTemp(FilePath);
+				Entry.Size = StatData.FileSize;
+				Entry.ModifiedTime = StatData.ModificationTime;
+			}
+			else if (IsSiblingTexture(FilePath))
+			{
+				Textures.Add(MoveTemp(FilePath));
+			}
+			return true;
+		}
+	};
+
+	// Stats every file below Root once. The subtrees of the top level folders are walked in parallel,
+	// which hides most of the latency of network drives.
+	void ScanDirectoryTree(const FString& Root, const std::atomic<bool>& bCancelled, TArray<FString>& OutFolders, TArray<FMeshAssetEntry>& OutModels)
+	{
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+		FScanResult TopLevel;
+		PlatformFile.IterateDirectoryStat(*Root, [&TopLevel](const TCHAR* Path, const FFileStatData& StatData)
+		{
+			return TopLevel.Visit(Path, StatData);
+		});
+
+		TArray<FScanResult> Subtrees;
+		Subtrees.SetNum(TopLevel.Folders.Num());
+		ParallelFor(TopLevel.Folders.Num(), [&](int32 FolderIdx)
+		{
+			PlatformFile.IterateDirectoryStatRecursively(*TopLevel.Folders[FolderIdx], [&bCancelled, &Subtree = Subtrees[FolderIdx]](const TCHAR* Path, const FFileStatData& StatData)
+			{
+				return !bCancelled && Subtree.Visit(Path, StatData);
+			});
+		}, EParallelForFlags::Unbalanced);
+
+		for (FScanResult& Subtree : Subtrees)
+		{
+			TopLevel.Folders.Append(MoveTemp(Subtree.Folders));
+			TopLevel.Models.Append(MoveTemp(Subtree.Models));
+			TopLevel.Textures.Append(MoveTemp(Subtree.Textures));
+		}
+
+		for (FMeshAssetEntry& Model : TopLevel.Models)
+		{
+			const FString TexturePath = GetSiblingTexturePath(Model.Path, TEXT("_T.png"));
+			const FString NormalPath = GetSiblingTexturePath(Model.Path, TEXT("_N.png"));
+			Model.TexturePath = TopLevel.Textures.Contains(TexturePath) ? TexturePath : FString();
+			Model.NormalPath = TopLevel.Textures.Contains(NormalPath) ? NormalPath : FString();
+		}
+
+		OutFolders = MoveTemp(TopLevel.Folders);
+		OutModels = MoveTemp(TopLevel.Models);
+		OutFolders.Sort();
+		OutModels.Sort([](const FMeshAssetEntry& A, const FMeshAssetEntry& B) { return A.Path < B.Path; });
+	}
+
+	bool IsSameIndex(const TArray<FString>& FoldersA, const TArray<FMeshAssetEntry>& ModelsA, const TArray<FString>& FoldersB, const TArray<FMeshAssetEntry>& ModelsB)
+	{
+		if (FoldersA != FoldersB || ModelsA.Num() != ModelsB.Num())
+		{
+			return false;
+		}
+		for (int32 ModelIdx = 0; ModelIdx < ModelsA.Num(); ModelIdx++)
+		{
+			const FMeshAssetEntry& A = ModelsA[ModelIdx];
+			const FMeshAssetEntry& B = ModelsB[ModelIdx];
+			if (A.Path != B.Path || A.Size != B.Size || A.ModifiedTime != B.ModifiedTime || A.TexturePath != B.TexturePath || A.NormalPath != B.NormalPath)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool LoadManifest(const FString& ManifestPath, const FString& Root, TArray<FString>& OutFolders, TArray<FMeshAssetEntry>& OutModels)
+	{
+		FString Json;
+		if (!FFileHelper::LoadFileToString(Json, *ManifestPath))
+		{
+			return false;
+		}
+
+		TSharedPtr<FJsonObject> Manifest;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+		if (!FJsonSerializer::Deserialize(Reader, Manifest) || !Manifest.IsValid()
+			|| Manifest->GetIntegerField(TEXT("Version")) != ManifestVersion
+			|| Manifest->GetStringField(TEXT("Root")) != Root)
+		{
+			return false;
+		}
+
+		// Paths are stored relative to the root, sibling textures as flags
+		const FString Prefix = Root + TEXT("/");
+		for (const TSharedPtr<FJsonValue>& Folder : Manifest->GetArrayField(TEXT("Folders")))
+		{
+			OutFolders.Add(Prefix + Folder->AsString());
+		}
+
+		for (const TSharedPtr<FJsonValue>& Value : Manifest->GetArrayField(TEXT("Models")))
+		{
+			const TSharedPtr<FJsonObject>& Object = Value->AsObject();
+			FMeshAssetEntry& Entry = OutModels.AddDefaulted_GetRef();
+			Entry.Path = Prefix + Object->GetStringField(TEXT("Path"));
+			Entry.Size = (int64)Object->GetNumberField(TEXT("Size"));
+			Entry.ModifiedTime = FDateTime(FCString::Atoi64(*Object->GetStringField(TEXT("Modified"))));
+			Entry.TexturePath = Object->GetBoolField(TEXT("Texture")) ? GetSiblingTexturePath(Entry.Path, TEXT("_T.png")) : FString();
+			Entry.NormalPath = Object->GetBoolField(TEXT("Normal")) ? GetSiblingTexturePath(Entry.Path, TEXT("_N.png")) : FString();
+		}
+		return true;
+	}
+
+	void WriteManifest(const FString& ManifestPath, const FString& Root, const TArray<FString>& Folders, const TArray<FMeshAssetEntry>& Models)
+	{
+		const int32 PrefixLength = Root.Len() + 1;
+
+		FString Json;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("Version"), ManifestVersion);
+		Writer->WriteValue(TEXT("Root"), Root);
+
+		Writer->WriteArrayStart(TEXT("Folders"));
+		for (const FString& Folder : Folders)
+		{
+			Writer->WriteValue(Folder.Mid(PrefixLength));
+		}
+		Writer->WriteArrayEnd();
+
+		Writer->WriteArrayStart(TEXT("Models"));
+		for (const FMeshAssetEntry& Model : Models)
+		{
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("Path"), Model.Path.Mid(PrefixLength));
+			Writer->WriteValue(TEXT("Size"), Model.Size);
+			// Ticks do not fit into a JSON number without losing precision
+			Writer->WriteValue(TEXT("Modified"), LexToString(Model.ModifiedTime.GetTicks()));
+			Writer->WriteValue(TEXT("Texture"), !Model.TexturePath.IsEmpty());
+			Writer->WriteValue(TEXT("Normal"), !Model.NormalPath.IsEmpty());
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteArrayEnd();
+
+		Writer->WriteObjectEnd();
+		Writer->Close();
+
+		if (!FFileHelper::SaveStringToFile(Json, *ManifestPath))
+		{
+			UE_LOG(LogRuntimeMeshLoader, Warning, TEXT("RuntimeMeshAssetIndex: Could not write manifest %s"), *ManifestPath);
+		}
+	}
+}
+
+URuntimeMeshAssetIndexSubsystem* URuntimeMeshAssetIndexSubsystem::Get()
+{
+	return GEngine ? GEngine->GetEngineSubsystem<URuntimeMeshAssetIndexSubsystem>() : nullptr;
+}
+
+void URuntimeMeshAssetIndexSubsystem::Deinitialize()
+{
+	if (ScanCancelled)
+	{
+		ScanCancelled->store(true);
+	}
+	StopWatching();
+	Super::Deinitialize();
+}
+
+void URuntimeMeshAssetIndexSubsystem::StartScan(FString InRootDirectory, bool bForceRescan)
+{
+	const FString Root = NormalizePath(InRootDirectory);
+	if (!FPaths::DirectoryExists(Root))
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("RuntimeMeshAssetIndex: Directory does not exist: %s"), *Root);
+		return;
+	}
+
+	// Stop a scan that is still running, its result would be thrown away anyway
+	if (ScanCancelled)
+	{
+		ScanCancelled->store(true);
+	}
+	StopWatching();
+
+	RootDirectory = Root;
+	bScanning = true;
+	ScanCancelled = MakeShared<std::atomic<bool>>(false);
+
+	const int32 Generation = ++ScanGeneration;
+	const FString ManifestPath = GetManifestPath();
+	TWeakObjectPtr<URuntimeMeshAssetIndexSubsystem> WeakThis(this);
+
+	// A dedicated thread, walking a large network share can take a while and should not block the thread pool
+	Async(EAsyncExecution::Thread, [WeakThis, Root, ManifestPath, bForceRescan, Generation, Cancelled = ScanCancelled]()
+	{
+		auto Apply = [WeakThis, Root, Generation](TArray<FString>&& Folders, TArray<FMeshAssetEntry>&& Models, bool bSaveManifest)
+		{
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, Root, Generation, bSaveManifest, Folders = MoveTemp(Folders), Models = MoveTemp(Models)]() mutable
+			{
+				URuntimeMeshAssetIndexSubsystem* Self = WeakThis.Get();
+				if (Self && Self->ScanGeneration == Generation)
+				{
+					Self->ApplySnapshot(Root, MoveTemp(Folders), MoveTemp(Models), bSaveManifest);
+				}
+			});
+		};
+
+		const double StartTime = FPlatformTime::Seconds();
+
+		TArray<FString> ManifestFolders;
+		TArray<FMeshAssetEntry> ManifestModels;
+		const bool bFromManifest = !bForceRescan && LoadManifest(ManifestPath, Root, ManifestFolders, ManifestModels);
+		if (bFromManifest)
+		{
+			UE_LOG(LogRuntimeMeshLoader, Log, TEXT("RuntimeMeshAssetIndex: Loaded %d folders and %d models of %s from the manifest in %.1f s"),
+				ManifestFolders.Num(), ManifestModels.Num(), *Root, FPlatformTime::Seconds() - StartTime);
+			Apply(TArray<FString>(ManifestFolders), TArray<FMeshAssetEntry>(ManifestModels), false);
+		}
+
+		// Without a manifest this is the initial scan. With one, it picks up what was added, removed or edited while
+		// the application was not running, and the index is only replaced if the directory differs from the manifest.
+		TArray<FString> Folders;
+		TArray<FMeshAssetEntry> Models;
+		ScanDirectoryTree(Root, *Cancelled, Folders, Models);
+		if (*Cancelled)
+		{
+			return;
+		}
+
+		if (bFromManifest && IsSameIndex(Folders, Models, ManifestFolders, ManifestModels))
+		{
+			UE_LOG(LogRuntimeMeshLoader, Log, TEXT("RuntimeMeshAssetIndex: Manifest of %s is up to date"), *Root);
+			return;
+		}
+
+		UE_LOG(LogRuntimeMeshLoader, Log, TEXT("RuntimeMeshAssetIndex: Scanned %d folders and %d models of %s in %.1f s"),
+			Folders.Num(), Models.Num(), *Root, FPlatformTime::Seconds() - StartTime);
+		Apply(MoveTemp(Folders), MoveTemp(Models), true);
+	});
+}
+
+TArray<FMeshAssetEntry> URuntimeMeshAssetIndexSubsystem::GetModels(int32 Offset, int32 Count, FString Folder, int32& TotalCount) const
+{
+	int32 First = 0;
+	int32 End = Models.Num();
+
+	// Models are sorted by path, so the models below a folder are a contiguous range
+	if (!Folder.IsEmpty())
+	{
+		const FString Prefix = NormalizePath(Folder) + TEXT("/");
+		First = Algo::LowerBoundBy(Models, Prefix, &FMeshAssetEntry::Path);
+		End = First;
+		while (End < Models.Num() && Models[End].Path.StartsWith(Prefix))
+		{
+			End++;
+		}
+	}
+
+	TotalCount = End - First;
+	const int32 PageStart = First + FMath::Clamp(Offset, 0, TotalCount);
+	const int32 PageEnd = FMath::Min(PageStart + FMath::Max(Count, 0), End);
+	return TArray<FMeshAssetEntry>(Models.GetData() + PageStart, PageEnd - PageStart);
+}
+
+TArray<FString> URuntimeMeshAssetIndexSubsystem::GetFolders(int32 Offset, int32 Count) const
+{
+	const int32 PageStart = FMath::Clamp(Offset, 0, Folders.Num());
+	const int32 PageEnd = FMath::Min(PageStart + FMath::Max(Count, 0), Folders.Num());
+	return TArray<FString>(Folders.GetData() + PageStart, PageEnd - PageStart);
+}
+
+void URuntimeMeshAssetIndexSubsystem::ApplySnapshot(const FString& ScannedRoot, TArray<FString>&& InFolders, TArray<FMeshAssetEntry>&& InModels, bool bSaveManifest)
+{
+	RootDirectory = ScannedRoot;
+	Folders = MoveTemp(InFolders);
+	Models = MoveTemp(InModels);
+	bScanning = false;
+
+	if (bSaveManifest)
+	{
+		SaveManifest();
+	}
+
+	StartWatching();
+	OnIndexUpdated.Broadcast();
+}
+
+void URuntimeMeshAssetIndexSubsystem::SaveManifest() const
+{
+	// Serialize a copy on a worker, the manifest of a large library is several megabytes
+	Async(EAsyncExecution::ThreadPool, [ManifestPath = GetManifestPath(), Root = RootDirectory, Folders = Folders, Models = Models]()
+	{
+		WriteManifest(ManifestPath, Root, Folders, Models);
+	});
+}
+
+FString URuntimeMeshAssetIndexSubsystem::GetManifestPath() const
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("RuntimeMeshLoader"), FString::Printf(TEXT("AssetIndex_%08x.json"), GetTypeHash(RootDirectory)));
+}
+
+void URuntimeMeshAssetIndexSubsystem::StartWatching()
+{
+	// A manifest is applied first and the checked scan after it, only register once
+	StopWatching();
+
+#if RUNTIME_MESH_LOADER_WITH_DIRECTORY_WATCHER
+	FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+	IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule.Get();
+	if (!DirectoryWatcher)
+	{
+		return;
+	}
+
+	DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+		RootDirectory,
+		IDirectoryWatcher::FDirectoryChanged::CreateUObject(this, &URuntimeMeshAssetIndexSubsystem::OnDirectoryChanged),
+		WatcherHandle,
+		IDirectoryWatcher::WatchOptions::IncludeDirectoryChanges);
+
+	// The editor ticks the directory watcher, other targets have to do it themselves
+	if (!GIsEditor)
+	{
+		WatcherTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &URuntimeMeshAssetIndexSubsystem::TickDirectoryWatcher));
+	}
+#endif
+}
+
+void URuntimeMeshAssetIndexSubsystem::StopWatching()
+{
+#if RUNTIME_MESH_LOADER_WITH_DIRECTORY_WATCHER
+	if (WatcherHandle.IsValid())
+	{
+		if (FDirectoryWatcherModule* DirectoryWatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")))
+		{
+			if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule->Get())
+			{
+				DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(RootDirectory, WatcherHandle);
+			}
+		}
+		WatcherHandle.Reset();
+	}
+#endif
+
+	if (WatcherTickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(WatcherTickHandle);
+		WatcherTickHandle.Reset();
+	}
+}
+
+bool URuntimeMeshAssetIndexSubsystem::TickDirectoryWatcher(float DeltaTime)
+{
+#if RUNTIME_MESH_LOADER_WITH_DIRECTORY_WATCHER
+	if (FDirectoryWatcherModule* DirectoryWatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")))
+	{
+		if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule->Get())
+		{
+			DirectoryWatcher->Tick(DeltaTime);
+		}
+	}
+#endif
+	return true;
+}
+
+void URuntimeMeshAssetIndexSubsystem::OnDirectoryChanged(const TArray<FFileChangeData>& Changes)
+{
+#if RUNTIME_MESH_LOADER_WITH_DIRECTORY_WATCHER
+	bool bChanged = false;
+
+	for (const FFileChangeData& Change : Changes)
+	{
+		if (Change.Action == FFileChangeData::FCA_RescanRequired)
+		{
+			// Rescan on the next tick, the watcher is still iterating its callbacks
+			FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float)
+			{
+				StartScan(RootDirectory, true);
+				return false;
+			}));
+			return;
+		}
+
+		const FString Path = NormalizePath(Change.Filename);
+		if (IsModelFile(Path))
+		{
+			if (Change.Action == FFileChangeData::FCA_Removed)
+			{
+				RemoveModel(Path);
+			}
+			else
+			{
+				UpsertModel(Path);
+			}
+			bChanged = true;
+		}
+		else if (IsSiblingTexture(Path))
+		{
+			// Re-evaluate the textures of every model named like the texture, whatever its extension
+			const FString ModelPrefix = Path.LeftChop(6) + TEXT(".");
+			for (int32 ModelIdx = Algo::LowerBoundBy(Models, ModelPrefix, &FMeshAssetEntry::Path); ModelIdx < Models.Num() && Models[ModelIdx].Path.StartsWith(ModelPrefix); ModelIdx++)
+			{
+				UpsertModel(FString(Models[ModelIdx].Path));
+				bChanged = true;
+			}
+		}
+		else if (Change.Action == FFileChangeData::FCA_Added && FPaths::DirectoryExists(Path))
+		{
+			const int32 FolderIdx = Algo::LowerBound(Folders, Path);
+			if (!Folders.IsValidIndex(FolderIdx) || Folders[FolderIdx] != Path)
+			{
+				Folders.Insert(Path, FolderIdx);
+				bChanged = true;
+			}
+
+			// A folder moved or copied into the library arrives as a single change, its contents are not reported
+			ScanAddedFolder(Path);
+		}
+		else if (Change.Action == FFileChangeData::FCA_Removed && Algo::BinarySearch(Folders, Path) != INDEX_NONE)
+		{
+			RemoveFolder(Path);
+			bChanged = true;
+		}
+	}
+
+	if (bChanged)
+	{
+		SaveManifest();
+		OnIndexUpdated.Broadcast();
+	}
+#endif
+}
+
+void URuntimeMeshAssetIndexSubsystem::ScanAddedFolder(const FString& FolderPath)
+{
+	TWeakObjectPtr<URuntimeMeshAssetIndexSubsystem> WeakThis(this);
+	Async(EAsyncExecution::Thread, [WeakThis, FolderPath, Generation = ScanGeneration, Cancelled = ScanCancelled]()
+	{
+		TArray<FString> SubFolders;
+		TArray<FMeshAssetEntry> SubModels;
+		ScanDirectoryTree(FolderPath, *Cancelled, SubFolders, SubModels);
+		if (*Cancelled)
+		{
+			return;
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, FolderPath, Generation, SubFolders = MoveTemp(SubFolders), SubModels = MoveTemp(SubModels)]() mutable
+		{
+			URuntimeMeshAssetIndexSubsystem* Self = WeakThis.Get();
+			if (Self && Self->ScanGeneration == Generation)
+			{
+				Self->MergeFolder(FolderPath, MoveTemp(SubFolders), MoveTemp(SubModels));
+			}
+		});
+	});
+}
+
+void URuntimeMeshAssetIndexSubsystem::MergeFolder(const FString& FolderPath, TArray<FString>&& SubFolders, TArray<FMeshAssetEntry>&& SubModels)
+{
+	// The scan is the current state of the subtree, replace whatever the index had below it
+	const FString Prefix = FolderPath + TEXT("/");
+	Folders.RemoveAll([&Prefix](const FString& Folder)
+	{
+		return Folder.StartsWith(Prefix);
+	});
+	Models.RemoveAll([&Prefix](const FMeshAssetEntry& Model)
+	{
+		return Model.Path.StartsWith(Prefix);
+	});
+
+	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("RuntimeMeshAssetIndex: Added %d folders and %d models below %s"), SubFolders.Num(), SubModels.Num(), *FolderPath);
+
+	Folders.Append(MoveTemp(SubFolders));
+	Models.Append(MoveTemp(SubModels));
+	Folders.Sort();
+	Models.Sort([](const FMeshAssetEntry& A, const FMeshAssetEntry& B) { return A.Path < B.Path; });
+
+	SaveManifest();
+	OnIndexUpdated.Broadcast();
+}
+
+void URuntimeMeshAssetIndexSubsystem::UpsertModel(const FString& ModelPath)
+{
+	const FFileStatData StatData = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*ModelPath);
+	if (!StatData.bIsValid || StatData.bIsDirectory)
+	{
+		RemoveModel(ModelPath);
+		return;
+	}
+
+	FMeshAssetEntry Entry;
+	Entry.Path = ModelPath;
+	Entry.Size = StatData.FileSize;
+	Entry.ModifiedTime = StatData.ModificationTime;
+
+	const FString TexturePath = GetSiblingTexturePath(ModelPath, TEXT("_T.png"));
+	const FString NormalPath = GetSiblingTexturePath(ModelPath, TEXT("_N.png"));
+	Entry.TexturePath = FPaths::FileExists(TexturePath) ? TexturePath : FString();
+	Entry.NormalPath = FPaths::FileExists(NormalPath) ? NormalPath : FString();
+
+	const int32 ModelIdx = Algo::LowerBoundBy(Models, ModelPath, &FMeshAssetEntry::Path);
+	if (Models.IsValidIndex(ModelIdx) && Models[ModelIdx].Path == ModelPath)
+	{
+		Models[ModelIdx] = MoveTemp(Entry);
+	}
+	else
+	{
+		Models.Insert(MoveTemp(Entry), ModelIdx);
+	}
+}
+
+void URuntimeMeshAssetIndexSubsystem::RemoveModel(const FString& ModelPath)
+{
+	const int32 ModelIdx = Algo::LowerBoundBy(Models, ModelPath, &FMeshAssetEntry::Path);
+	if (Models.IsValidIndex(ModelIdx) && Models[ModelIdx].Path == ModelPath)
+	{
+		Models.RemoveAt(ModelIdx);
+	}
+}
+
+void URuntimeMeshAssetIndexSubsystem::RemoveFolder(const FString& FolderPath)
+{
+	const FString Prefix = FolderPath + TEXT("/");
+	Folders.RemoveAll([&FolderPath, &Prefix](const FString& Folder)
+	{
+		return Folder == FolderPath || Folder.StartsWith(Prefix);
+	});
+	Models.RemoveAll([&Prefix](const FMeshAssetEntry& Model)
+	{
+		return Model.Path.StartsWith(Prefix);
+	});
+}
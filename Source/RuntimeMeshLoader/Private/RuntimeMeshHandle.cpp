@@ -0,0 +1,135 @@
+#include "RuntimeMeshHandle.h"
+#include "RuntimeMeshLoader.h"
+
+URuntimeMeshHandle* URuntimeMeshHandle::Create(FFinalReturnData&& ReturnData)
+{
+	if (!ReturnData.Success)
+	{
+		return nullptr;
+	}
+
+	URuntimeMeshHandle* Handle = NewObject<URuntimeMeshHandle>();
+	for (int32 NodeIndex = 0; NodeIndex < ReturnData.Nodes.Num(); NodeIndex++)
+	{
+		for (int32 MeshIndex = 0; MeshIndex < ReturnData.Nodes[NodeIndex].Meshes.Num(); MeshIndex++)
+		{
+			Handle->MeshIndices.Add(FIntPoint(NodeIndex, MeshIndex));
+		}
+	}
+	Handle->Data = MakeShared<const FFinalReturnData>(MoveTemp(ReturnData));
+	return Handle;
+}
+
+const FMeshData* URuntimeMeshHandle::GetMesh(int32 MeshIndex) const
+{
+	if (!Data.IsValid() || !MeshIndices.IsValidIndex(MeshIndex))
+	{
+		return nullptr;
+	}
+	const FIntPoint& Index = MeshIndices[MeshIndex];
+	return &Data->Nodes[Index.X].Meshes[Index.Y];
+}
+
+int32 URuntimeMeshHandle::GetNumNodes() const
+{
+	return Data.IsValid() ? Data->Nodes.Num() : 0;
+}
+
+int32 URuntimeMeshHandle::GetMeshNodeIndex(int32 MeshIndex) const
+{
+	return MeshIndices.IsValidIndex(MeshIndex) ? MeshIndices[MeshIndex].X : INDEX_NONE;
+}
+
+int32 URuntimeMeshHandle::GetMeshVertexCount(int32 MeshIndex) const
+{
+	const FMeshData* Mesh = GetMesh(MeshIndex);
+	return Mesh ? Mesh->Vertices.Num() : 0;
+}
+
+int32 URuntimeMeshHandle::GetMeshTriangleCount(int32 MeshIndex) const
+{
+	const FMeshData* Mesh = GetMesh(MeshIndex);
+	return Mesh ? Mesh->Triangles.Num() / 3 : 0;
+}
+
+FTransform URuntimeMeshHandle::GetNodeTransform(int32 NodeIndex, int32& ParentIndex) const
+{
+	if (!Data.IsValid() || !Data->Nodes.IsValidIndex(NodeIndex))
+	{
+		ParentIndex = INDEX_NONE;
+		return FTransform::Identity;
+	}
+	ParentIndex = Data->Nodes[NodeIndex].NodeParentIndex;
+	return Data->Nodes[NodeIndex].RelativeTransformTransform;
+}
+
+FMeshLoadMemoryReport URuntimeMeshHandle::GetMemoryReport() const
+{
+	return Data.IsValid() ? Data->Memory : FMeshLoadMemoryReport();
+}
+
+bool URuntimeMeshHandle::GetMeshSection(int32 MeshIndex, FMeshData& MeshData) const
+{
+	const FMeshData* Mesh = GetMesh(MeshIndex);
+	if (!Mesh)
+	{
+		return false;
+	}
+	MeshData = *Mesh;
+	return true;
+}
+
+bool URuntimeMeshHandle::CreateMeshSection(UProceduralMeshComponent* ProceduralMeshComponent, int32 SectionIndex, int32 MeshIndex, bool bCreateCollision) const
+{
+	const FMeshData* Mesh = GetMesh(MeshIndex);
+	if (!ProceduralMeshComponent || !Mesh)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("RuntimeMeshHandle: Invalid procedural mesh component or mesh index %d"), MeshIndex);
+		return false;
+	}
+
+	ProceduralMeshComponent->CreateMeshSection(
+		SectionIndex,
+		Mesh->Vertices,
+		Mesh->Triangles,
+		Mesh->Normals,
+		Mesh->UVs,
+		TArray<FColor>(),
+		Mesh->Tangents,
+		bCreateCollision
+	);
+	return true;
+}
+
+int32 URuntimeMeshHandle::CreateMeshSections(UProceduralMeshComponent* ProceduralMeshComponent, UMaterialInterface* Material, bool bClearMesh, bool bCreateCollision) const
+{
+	if (!ProceduralMeshComponent)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("RuntimeMeshHandle: Invalid procedural mesh component"));
+		return 0;
+	}
+
+	if (bClearMesh)
+	{
+		ProceduralMeshComponent->ClearAllMeshSections();
+	}
+
+	int32 SectionIdx = 0;
+	for (int32 MeshIndex = 0; MeshIndex < MeshIndices.Num(); MeshIndex++)
+	{
+		// Skip empty meshes
+		const FMeshData* Mesh = GetMesh(MeshIndex);
+		if (Mesh->Vertices.Num() == 0 || Mesh->Triangles.Num() == 0)
+		{
+			continue;
+		}
+
+		CreateMeshSection(ProceduralMeshComponent, SectionIdx, MeshIndex, bCreateCollision);
+		if (Material)
+		{
+			ProceduralMeshComponent->SetMaterial(SectionIdx, Material);
+		}
+		SectionIdx++;
+	}
+	return SectionIdx;
+}
@@ -0,0 +1,140 @@
+#include "RuntimeMeshLODComponent.h"
+#include "RuntimeMeshLoader.h"
+#include "RuntimeMeshLoaderHelper.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+
+URuntimeMeshLODComponent::URuntimeMeshLODComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	// Screen size changes slowly, no need to evaluate it every frame
+	PrimaryComponentTick.TickInterval = 0.1f;
+}
+
+void URuntimeMeshLODComponent::SetMeshData(const FFinalReturnData& MeshData, UMaterialInterface* Material, bool bCreateCollision)
+{
+	ClearAllMeshSections();
+	MeshSections.Reset();
+	CurrentLOD = 0;
+
+	int32 SectionIdx = 0;
+	for (const FNodeData& Node : MeshData.Nodes)
+	{
+		for (const FMeshData& Mesh : Node.Meshes)
+		{
+			// Skip empty meshes
+			if (Mesh.Vertices.Num() == 0 || Mesh.Triangles.Num() == 0)
+			{
+				continue;
+			}
+
+			FLODSections& Sections = MeshSections.AddDefaulted_GetRef();
+
+			// CreateMeshSection re-cooks the collision of every flagged section, collision is enabled below instead
+			CreateMeshSection(SectionIdx, Mesh.Vertices, Mesh.Triangles, Mesh.Normals, Mesh.UVs, TArray<FColor>(), Mesh.Tangents, false);
+			Sections.SectionIndices.Add(SectionIdx++);
+
+			for (const FMeshLODData& LOD : Mesh.LODs)
+			{
+				CreateMeshSection(SectionIdx, LOD.Vertices, LOD.Triangles, LOD.Normals, LOD.UVs, TArray<FColor>(), LOD.Tangents, false);
+				SetMeshSectionVisible(SectionIdx, false);
+				Sections.SectionIndices.Add(SectionIdx++);
+				Sections.ScreenSizes.Add(LOD.ScreenSize);
+			}
+		}
+	}
+
+	// Flag the LOD0 sections once they all exist, so the model is cooked a single time. The LOD sections created after
+	// the last LOD0 section would trigger another cook if it had been created with collision.
+	if (bCreateCollision && MeshSections.Num() > 0)
+	{
+		for (const FLODSections& Sections : MeshSections)
+		{
+			if (FProcMeshSection* Section = GetProcMeshSection(Sections.SectionIndices[0]))
+			{
+				Section->bEnableCollision = true;
+			}
+		}
+		URuntimeMeshLoaderHelper::RebuildCollision(this);
+	}
+
+	if (Material)
+	{
+		for (int32 Idx = 0; Idx < SectionIdx; Idx++)
+		{
+			SetMaterial(Idx, Material);
+		}
+	}
+
+	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("RuntimeMeshLODComponent: Created %d sections for %d meshes"), SectionIdx, MeshSections.Num());
+
+	UpdateVisibleLODs(GetScreenSize());
+}
+
+void URuntimeMeshLODComponent::SetForcedLOD(int32 LODIndex)
+{
+	ForcedLOD = LODIndex < 0 ? INDEX_NONE : LODIndex;
+	UpdateVisibleLODs(GetScreenSize());
+}
+
+float URuntimeMeshLODComponent::GetScreenSize() const
+{
+	UWorld* World = GetWorld();
+	APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+	if (!PlayerController || !PlayerController->PlayerCameraManager)
+	{
+		// No view to measure against, display full detail
+		return 1.0f;
+	}
+
+	const FVector CameraLocation = PlayerController->PlayerCameraManager->GetCameraLocation();
+	const float HalfFOVRadians = FMath::DegreesToRadians(PlayerController->PlayerCameraManager->GetFOVAngle() * 0.5f);
+	const double Distance = FMath::Max((double)FVector::Dist(CameraLocation, Bounds.Origin), 1.0);
+
+	// Same metric as ComputeBoundsScreenSize: diameter of the bounding sphere relative to the screen width
+	return (float)(Bounds.SphereRadius / (Distance * FMath::Tan(HalfFOVRadians)));
+}
+
+void URuntimeMeshLODComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (MeshSections.Num() > 0)
+	{
+		UpdateVisibleLODs(GetScreenSize());
+	}
+}
+
+int32 URuntimeMeshLODComponent::SelectLOD(const FLODSections& Mesh, float ScreenSize) const
+{
+	const int32 LastLOD = Mesh.SectionIndices.Num() - 1;
+	if (ForcedLOD != INDEX_NONE)
+	{
+		return FMath::Min(ForcedLOD, LastLOD);
+	}
+
+	int32 LODIndex = 0;
+	while (LODIndex < Mesh.ScreenSizes.Num() && ScreenSize < Mesh.ScreenSizes[LODIndex])
+	{
+		LODIndex++;
+	}
+	return LODIndex;
+}
+
+void URuntimeMeshLODComponent::UpdateVisibleLODs(float ScreenSize)
+{
+	CurrentLOD = 0;
+	for (FLODSections& Mesh : MeshSections)
+	{
+		const int32 NewLOD = SelectLOD(Mesh, ScreenSize);
+		if (NewLOD != Mesh.VisibleLOD)
+		{
+			SetMeshSectionVisible(Mesh.SectionIndices[Mesh.VisibleLOD], false);
+			SetMeshSectionVisible(Mesh.SectionIndices[NewLOD], true);
+			Mesh.VisibleLOD = NewLOD;
+		}
+		CurrentLOD = FMath::Max(CurrentLOD, NewLOD);
+	}
+}
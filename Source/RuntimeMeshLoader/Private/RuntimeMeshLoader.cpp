@@ -2,6 +2,7 @@
 
 #include "RuntimeMeshLoader.h"
 #include "Modules/ModuleManager.h"
+#include "IImageWrapperModule.h"
 #include "Interfaces/IPluginManager.h"
 #include "HAL/PlatformProcess.h"
 #include "Misc/Paths.h"
@@ -22,6 +23,9 @@ void FRuntimeMeshLoaderModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
 	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("RuntimeMeshLoader: Module startup"));
+
+	// Textures are decoded on worker threads, which may look the module up but must not load it
+	FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
 	
 	// Get the base directory of this plugin
 	FString BaseDir = IPluginManager::Get().FindPlugin("RuntimeMeshLoader")->GetBaseDir();
@@ -1,12 +1,20 @@
 #include "RuntimeMeshLoaderHelper.h"
 #include "MeshLoader.h"
+#include "CompactMeshData.h"
+#include "SceneBufferData.h"
 #include "RuntimeMeshLoader.h"
+#include "RuntimeMeshPoolSubsystem.h"
 #include "Materials/Material.h"
 #include "Materials/MaterialInstanceDynamic.h"
+#include "PhysicsEngine/BodySetup.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Materials/MaterialExpressionTextureSample.h"
 #include "Materials/MaterialExpressionConstant3Vector.h"
 #include "Materials/MaterialExpressionMultiply.h"
+#include "Components/DynamicMeshComponent.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "DynamicMesh/DynamicMeshAttributeSet.h"
+#include "Async/Async.h"
 
 // Create a simpler basic material function that doesn't directly access material properties
 UMaterial* CreateBasicMaterial()
@@ -20,6 +28,61 @@ UMaterial* CreateBasicMaterial()
     return NewMaterial;
 }
 
+// Takes a material instance from the pool when possible, so released instances are reused
+UMaterialInstanceDynamic* CreateMaterialInstance(UMaterialInterface* BaseMaterial)
+{
+    if (URuntimeMeshPoolSubsystem* Pool = URuntimeMeshPoolSubsystem::Get())
+    {
+        return Pool->AcquireMaterialInstance(BaseMaterial);
+    }
+    return UMaterialInstanceDynamic::Create(BaseMaterial, nullptr);
+}
+
+// Creates one section per non-empty mesh, using the textures next to FilePath for the material
+void CreateSectionsWithMaterial(UProceduralMeshComponent* ProceduralMeshComponent, const FFinalReturnData& ReturnData, const FString& FilePath, bool bClearMesh)
+{
+    // Clear existing mesh if requested
+    if (bClearMesh)
+    {
+        ProceduralMeshComponent->ClearAllMeshSections();
+    }
+
+    // Load textures and create the material shared by all sections
+    UMaterialInstanceDynamic* Material = URuntimeMeshLoaderHelper::CreateMaterialForMeshFile(FilePath);
+
+    // Add mesh sections
+    int32 SectionIdx = 0;
+    for (const FNodeData& Node : ReturnData.Nodes)
+    {
+        for (const FMeshData& MeshData : Node.Meshes)
+        {
+            // Skip empty meshes
+            if (MeshData.Vertices.Num() == 0 || MeshData.Triangles.Num() == 0)
+            {
+                continue;
+            }
+            
+            ProceduralMeshComponent->CreateMeshSection(
+                SectionIdx,
+                MeshData.Vertices,
+                MeshData.Triangles,
+                MeshData.Normals,
+                MeshData.UVs,
+                TArray<FColor>(),
+                MeshData.Tangents,
+                true // Create collision
+            );
+            
+            if (Material)
+            {
+                ProceduralMeshComponent->SetMaterial(SectionIdx, Material);
+            }
+            
+            SectionIdx++;
+        }
+    }
+}
+
 bool URuntimeMeshLoaderHelper::LoadMeshWithTextures(UProceduralMeshComponent* ProceduralMeshComponent, 
                                                  FString FilePath, 
                                                  EPathType Type,
@@ -55,19 +118,456 @@ bool URuntimeMeshLoaderHelper::LoadMeshWithTextures(UProceduralMeshComponent* Pr
     // Note: In UE5.5, we'll handle two-sided rendering at the material level instead of the component level
 
     // Load the mesh
-    FFinalReturnData ReturnData = UMeshLoader::LoadMeshFromFile(FilePath, Type);
+    FMeshImportOptions Options;
+    Options.bPrefetchTextures = true;
+    FFinalReturnData ReturnData = UMeshLoader::LoadMeshFromFileWithOptions(FilePath, Type, Options);
     if (!ReturnData.Success)
     {
         UE_LOG(LogRuntimeMeshLoader, Error, TEXT("LoadMeshWithTextures: Failed to load mesh from %s"), *FilePath);
         return false;
     }
 
-    // Clear existing mesh if requested
+    CreateSectionsWithMaterial(ProceduralMeshComponent, ReturnData, FilePath, bClearMesh);
+    return true;
+}
+
+bool URuntimeMeshLoaderHelper::LoadMeshSectionsWithTextures(UProceduralMeshComponent* ProceduralMeshComponent,
+                                                          FString FilePath,
+                                                          EPathType Type,
+                                                          bool bClearMesh,
+                                                          bool bCreateCollision)
+{
+    if (!ProceduralMeshComponent)
+    {
+        UE_LOG(LogRuntimeMeshLoader, Error, TEXT("LoadMeshSectionsWithTextures: Invalid ProceduralMeshComponent"));
+        return false;
+    }
+
+    FMeshImportOptions Options;
+    Options.bPrefetchTextures = true;
+    TArray<FProcMeshSection> Sections;
+    if (!UMeshLoader::LoadMeshSectionsFromFile(FilePath, Type, Options, Sections))
+    {
+        UE_LOG(LogRuntimeMeshLoader, Error, TEXT("LoadMeshSectionsWithTextures: Failed to load mesh from %s"), *FilePath);
+        return false;
+    }
+
     if (bClearMesh)
     {
         ProceduralMeshComponent->ClearAllMeshSections();
     }
 
+    UMaterialInstanceDynamic* Material = URuntimeMeshLoaderHelper::CreateMaterialForMeshFile(FilePath);
+
+    for (int32 SectionIdx = 0; SectionIdx < Sections.Num(); SectionIdx++)
+    {
+        Sections[SectionIdx].bEnableCollision = bCreateCollision;
+        ProceduralMeshComponent->SetProcMeshSection(SectionIdx, Sections[SectionIdx]);
+        // The component keeps its own copy, free ours right away
+        Sections[SectionIdx] = FProcMeshSection();
+
+        if (Material)
+        {
+            ProceduralMeshComponent->SetMaterial(SectionIdx, Material);
+        }
+    }
+
+    // SetProcMeshSection does not cook, do it once for all sections
+    if (bCreateCollision)
+    {
+        RebuildCollision(ProceduralMeshComponent);
+    }
+    return true;
+}
+
+// Returns true if the existing sections of the component match the non-empty meshes of ReturnData
+// in vertex count and index buffer, so their vertex buffers can be updated in place
+bool HasSameSectionLayout(UProceduralMeshComponent* ProceduralMeshComponent, const FFinalReturnData& ReturnData)
+{
+    int32 SectionIdx = 0;
+    for (const FNodeData& Node : ReturnData.Nodes)
+    {
+        for (const FMeshData& MeshData : Node.Meshes)
+        {
+            // Skip empty meshes, they did not get a section either
+            if (MeshData.Vertices.Num() == 0 || MeshData.Triangles.Num() == 0)
+            {
+                continue;
+            }
+
+            FProcMeshSection* Section = ProceduralMeshComponent->GetProcMeshSection(SectionIdx);
+            if (!Section
+                || Section->ProcVertexBuffer.Num() != MeshData.Vertices.Num()
+                || Section->ProcIndexBuffer.Num() != MeshData.Triangles.Num())
+            {
+                return false;
+            }
+
+            // UpdateMeshSection cannot change indices, so the topology itself has to be identical
+            static_assert(sizeof(uint32) == sizeof(int32), "Index buffers are compared bytewise");
+            if (FMemory::Memcmp(Section->ProcIndexBuffer.GetData(), MeshData.Triangles.GetData(), MeshData.Triangles.Num() * sizeof(int32)) != 0)
+            {
+                return false;
+            }
+
+            SectionIdx++;
+        }
+    }
+
+    return SectionIdx == ProceduralMeshComponent->GetNumSections();
+}
+
+bool URuntimeMeshLoaderHelper::ReloadMeshWithTextures(UProceduralMeshComponent* ProceduralMeshComponent, 
+                                                   FString FilePath, 
+                                                   EPathType Type,
+                                                   bool& bUpdatedInPlace)
+{
+    bUpdatedInPlace = false;
+
+    if (!ProceduralMeshComponent)
+    {
+        UE_LOG(LogRuntimeMeshLoader, Error, TEXT("ReloadMeshWithTextures: Invalid ProceduralMeshComponent"));
+        return false;
+    }
+
+    FFinalReturnData ReturnData = UMeshLoader::LoadMeshFromFile(FilePath, Type);
+    if (!ReturnData.Success)
+    {
+        UE_LOG(LogRuntimeMeshLoader, Error, TEXT("ReloadMeshWithTextures: Failed to load mesh from %s"), *FilePath);
+        return false;
+    }
+
+    if (!HasSameSectionLayout(ProceduralMeshComponent, ReturnData))
+    {
+        UE_LOG(LogRuntimeMeshLoader, Log, TEXT("ReloadMeshWithTextures: Section layout of %s changed, rebuilding all sections"), *FilePath);
+        CreateSectionsWithMaterial(ProceduralMeshComponent, ReturnData, FilePath, true);
+        return true;
+    }
+
+    // UpdateMeshSection hands the positions of all collision sections to the body instance on every call,
+    // which Chaos trimeshes ignore. Switch collision off while updating and cook it once afterwards instead.
+    TBitArray<> CollisionSections(false, ProceduralMeshComponent->GetNumSections());
+    for (int32 Idx = 0; Idx < ProceduralMeshComponent->GetNumSections(); Idx++)
+    {
+        FProcMeshSection* Section = ProceduralMeshComponent->GetProcMeshSection(Idx);
+        CollisionSections[Idx] = Section->bEnableCollision;
+        Section->bEnableCollision = false;
+    }
+
+    // Same layout, only push the new vertex data to the existing buffers
+    int32 SectionIdx = 0;
+    for (const FNodeData& Node : ReturnData.Nodes)
+    {
+        for (const FMeshData& MeshData : Node.Meshes)
+        {
+            if (MeshData.Vertices.Num() == 0 || MeshData.Triangles.Num() == 0)
+            {
+                continue;
+            }
+
+            ProceduralMeshComponent->UpdateMeshSection(
+                SectionIdx,
+                MeshData.Vertices,
+                MeshData.Normals,
+                MeshData.UVs,
+                TArray<FColor>(),
+                MeshData.Tangents
+            );
+
+            SectionIdx++;
+        }
+    }
+
+    bool bHasCollision = false;
+    for (int32 Idx = 0; Idx < CollisionSections.Num(); Idx++)
+    {
+        ProceduralMeshComponent->GetProcMeshSection(Idx)->bEnableCollision = CollisionSections[Idx];
+        bHasCollision |= CollisionSections[Idx];
+    }
+    if (bHasCollision)
+    {
+        RebuildCollision(ProceduralMeshComponent);
+    }
+
+    UE_LOG(LogRuntimeMeshLoader, Log, TEXT("ReloadMeshWithTextures: Updated %d sections of %s in place"), SectionIdx, *FilePath);
+    bUpdatedInPlace = true;
+    return true;
+}
+
+void URuntimeMeshLoaderHelper::RebuildCollision(UProceduralMeshComponent* ProceduralMeshComponent)
+{
+    if (!ProceduralMeshComponent)
+    {
+        return;
+    }
+
+    // The component has no public call to only re-cook, setting its convex shapes again is the one that
+    // triggers a cook without dropping them
+    TArray<TArray<FVector>> ConvexMeshes;
+    if (UBodySetup* BodySetup = ProceduralMeshComponent->GetBodySetup())
+    {
+        for (const FKConvexElem& ConvexElem : BodySetup->AggGeom.ConvexElems)
+        {
+            ConvexMeshes.Add(ConvexElem.VertexData);
+        }
+    }
+    ProceduralMeshComponent->SetCollisionConvexMeshes(ConvexMeshes);
+}
+
+void URuntimeMeshLoaderHelper::CreateMeshSectionFromCompact(UProceduralMeshComponent* ProceduralMeshComponent,
+                                                             int32 SectionIndex,
+                                                             const FCompactMeshData& MeshData,
+                                                             bool bCreateCollision,
+                                                             bool bUpdateCollision)
+{
+    if (!ProceduralMeshComponent)
+    {
+        UE_LOG(LogRuntimeMeshLoader, Error, TEXT("CreateMeshSectionFromCompact: Invalid procedural mesh component"));
+        return;
+    }
+
+    // The procedural mesh component keeps its own full precision copy, the unpacked section only lives for this call
+    FProcMeshSection Section;
+    MeshData.ToProcMeshSection(Section);
+    Section.bEnableCollision = bCreateCollision;
+    ProceduralMeshComponent->SetProcMeshSection(SectionIndex, Section);
+
+    // SetProcMeshSection leaves the cooked collision as it was
+    if (bCreateCollision && bUpdateCollision)
+    {
+        RebuildCollision(ProceduralMeshComponent);
+    }
+}
+
+void URuntimeMeshLoaderHelper::CreateMeshSectionFromSceneBuffers(UProceduralMeshComponent* ProceduralMeshComponent,
+                                                                  int32 SectionIndex,
+                                                                  const FSceneBufferData& SceneData,
+                                                                  int32 MeshIndex,
+                                                                  bool bCreateCollision,
+                                                                  bool bUpdateCollision)
+{
+    if (!ProceduralMeshComponent || !SceneData.Meshes.IsValidIndex(MeshIndex))
+    {
+        UE_LOG(LogRuntimeMeshLoader, Error, TEXT("CreateMeshSectionFromSceneBuffers: Invalid procedural mesh component or mesh index %d"), MeshIndex);
+        return;
+    }
+
+    FProcMeshSection Section;
+    SceneData.ToProcMeshSection(MeshIndex, Section);
+    Section.bEnableCollision = bCreateCollision;
+    ProceduralMeshComponent->SetProcMeshSection(SectionIndex, Section);
+
+    if (bCreateCollision && bUpdateCollision)
+    {
+        RebuildCollision(ProceduralMeshComponent);
+    }
+}
+
+void URuntimeMeshLoaderHelper::ConvertToDynamicMesh(const FFinalReturnData& ReturnData, UE::Geometry::FDynamicMesh3& OutMesh)
+{
+    using namespace UE::Geometry;
+
+    OutMesh.Clear();
+    OutMesh.EnableTriangleGroups();
+    OutMesh.EnableAttributes();
+    OutMesh.Attributes()->EnableMaterialID();
+
+    FDynamicMeshNormalOverlay* NormalOverlay = OutMesh.Attributes()->PrimaryNormals();
+    FDynamicMeshUVOverlay* UVOverlay = OutMesh.Attributes()->PrimaryUV();
+    FDynamicMeshMaterialAttribute* MaterialIDs = OutMesh.Attributes()->GetMaterialID();
+
+    TArray<int32> VertexIds;
+    TArray<int32> NormalIds;
+    TArray<int32> UVIds;
+
+    int32 MeshIdx = 0;
+    for (const FNodeData& Node : ReturnData.Nodes)
+    {
+        for (const FMeshData& MeshData : Node.Meshes)
+        {
+            // Skip empty meshes
+            if (MeshData.Vertices.Num() == 0 || MeshData.Triangles.Num() == 0)
+            {
+                continue;
+            }
+
+            const int32 NumVertices = MeshData.Vertices.Num();
+            const bool bHasNormals = MeshData.Normals.Num() == NumVertices;
+            const bool bHasUVs = MeshData.UVs.Num() == NumVertices;
+
+            VertexIds.SetNumUninitialized(NumVertices);
+            NormalIds.SetNumUninitialized(bHasNormals ? NumVertices : 0);
+            UVIds.SetNumUninitialized(bHasUVs ? NumVertices : 0);
+
+            for (int32 i = 0; i < NumVertices; i++)
+            {
+                VertexIds[i] = OutMesh.AppendVertex(FVector3d(MeshData.Vertices[i]));
+                if (bHasNormals)
+                {
+                    NormalIds[i] = NormalOverlay->AppendElement(FVector3f(MeshData.Normals[i]));
+                }
+                if (bHasUVs)
+                {
+                    UVIds[i] = UVOverlay->AppendElement(FVector2f(MeshData.UVs[i]));
+                }
+            }
+
+            for (int32 i = 0; i + 2 < MeshData.Triangles.Num(); i += 3)
+            {
+                const int32 A = MeshData.Triangles[i];
+                const int32 B = MeshData.Triangles[i + 1];
+                const int32 C = MeshData.Triangles[i + 2];
+
+                FIndex3i TriangleNormals = bHasNormals ? FIndex3i(NormalIds[A], NormalIds[B], NormalIds[C]) : FIndex3i::Invalid();
+                FIndex3i TriangleUVs = bHasUVs ? FIndex3i(UVIds[A], UVIds[B], UVIds[C]) : FIndex3i::Invalid();
+
+                int32 TriangleId = OutMesh.AppendTriangle(VertexIds[A], VertexIds[B], VertexIds[C], MeshIdx);
+                if (TriangleId == FDynamicMesh3::NonManifoldID)
+                {
+                    // FDynamicMesh3 only accepts manifold edges, give the triangle its own vertices instead.
+                    // Overlay elements belong to exactly one vertex, so the new vertices get their own copies as well.
+                    const int32 NewA = OutMesh.AppendVertex(OutMesh.GetVertex(VertexIds[A]));
+                    const int32 NewB = OutMesh.AppendVertex(OutMesh.GetVertex(VertexIds[B]));
+                    const int32 NewC = OutMesh.AppendVertex(OutMesh.GetVertex(VertexIds[C]));
+                    TriangleId = OutMesh.AppendTriangle(NewA, NewB, NewC, MeshIdx);
+
+                    if (TriangleId >= 0 && bHasNormals)
+                    {
+                        TriangleNormals = FIndex3i(
+                            NormalOverlay->AppendElement(FVector3f(MeshData.Normals[A])),
+                            NormalOverlay->AppendElement(FVector3f(MeshData.Normals[B])),
+                            NormalOverlay->AppendElement(FVector3f(MeshData.Normals[C])));
+                    }
+                    if (TriangleId >= 0 && bHasUVs)
+                    {
+                        TriangleUVs = FIndex3i(
+                            UVOverlay->AppendElement(FVector2f(MeshData.UVs[A])),
+                            UVOverlay->AppendElement(FVector2f(MeshData.UVs[B])),
+                            UVOverlay->AppendElement(FVector2f(MeshData.UVs[C])));
+                    }
+                }
+                if (TriangleId < 0)
+                {
+                    continue;
+                }
+
+                if (bHasNormals)
+                {
+                    NormalOverlay->SetTriangle(TriangleId, TriangleNormals);
+                }
+                if (bHasUVs)
+                {
+                    UVOverlay->SetTriangle(TriangleId, TriangleUVs);
+                }
+                MaterialIDs->SetValue(TriangleId, MeshIdx);
+            }
+
+            MeshIdx++;
+        }
+    }
+}
+
+// Swaps the converted mesh into the component and assigns the textured material to every material ID
+void ApplyDynamicMesh(UDynamicMeshComponent* DynamicMeshComponent, UE::Geometry::FDynamicMesh3&& Mesh, const FString& FilePath, bool bCreateCollision)
+{
+    // One polygroup / material ID per source mesh
+    const int32 NumMaterials = FMath::Max(Mesh.MaxGroupID(), 1);
+
+    DynamicMeshComponent->SetMesh(MoveTemp(Mesh));
+    DynamicMeshComponent->SetTangentsType(EDynamicMeshComponentTangentsMode::AutoCalculated);
+
+    UMaterialInterface* Material = URuntimeMeshLoaderHelper::CreateMaterialForMeshFile(FilePath);
+    if (Material)
+    {
+        TArray<UMaterialInterface*> Materials;
+        Materials.Init(Material, NumMaterials);
+        DynamicMeshComponent->ConfigureMaterialSet(Materials);
+    }
+
+    if (bCreateCollision)
+    {
+        DynamicMeshComponent->EnableComplexAsSimpleCollision();
+    }
+}
+
+bool URuntimeMeshLoaderHelper::LoadMeshIntoDynamicMeshComponent(UDynamicMeshComponent* DynamicMeshComponent,
+                                                             FString FilePath,
+                                                             EPathType Type,
+                                                             bool bCreateCollision)
+{
+    if (!DynamicMeshComponent)
+    {
+        UE_LOG(LogRuntimeMeshLoader, Error, TEXT("LoadMeshIntoDynamicMeshComponent: Invalid DynamicMeshComponent"));
+        return false;
+    }
+
+    FMeshImportOptions Options;
+    Options.bPrefetchTextures = true;
+    FFinalReturnData ReturnData = UMeshLoader::LoadMeshFromFileWithOptions(FilePath, Type, Options);
+    if (!ReturnData.Success)
+    {
+        UE_LOG(LogRuntimeMeshLoader, Error, TEXT("LoadMeshIntoDynamicMeshComponent: Failed to load mesh from %s"), *FilePath);
+        return false;
+    }
+
+    UE::Geometry::FDynamicMesh3 Mesh;
+    ConvertToDynamicMesh(ReturnData, Mesh);
+    ApplyDynamicMesh(DynamicMeshComponent, MoveTemp(Mesh), FilePath, bCreateCollision);
+    return true;
+}
+
+void URuntimeMeshLoaderHelper::LoadMeshIntoDynamicMeshComponentAsync(UDynamicMeshComponent* DynamicMeshComponent,
+                                                                  FString FilePath,
+                                                                  EPathType Type,
+                                                                  bool bCreateCollision,
+                                                                  const FOnDynamicMeshLoaded& OnLoaded)
+{
+    if (!DynamicMeshComponent)
+    {
+        UE_LOG(LogRuntimeMeshLoader, Error, TEXT("LoadMeshIntoDynamicMeshComponentAsync: Invalid DynamicMeshComponent"));
+        OnLoaded.ExecuteIfBound(nullptr, false);
+        return;
+    }
+
+    TWeakObjectPtr<UDynamicMeshComponent> WeakComponent(DynamicMeshComponent);
+    Async(EAsyncExecution::ThreadPool, [WeakComponent, FilePath, Type, bCreateCollision, OnLoaded]()
+    {
+        FMeshImportOptions Options;
+        Options.bPrefetchTextures = true;
+        FFinalReturnData ReturnData = UMeshLoader::LoadMeshFromFileWithOptions(FilePath, Type, Options);
+        const bool bSuccess = ReturnData.Success;
+
+        UE::Geometry::FDynamicMesh3 Mesh;
+        if (bSuccess)
+        {
+            ConvertToDynamicMesh(ReturnData, Mesh);
+        }
+        ReturnData = FFinalReturnData();
+
+        // Components and materials may only be touched on the game thread
+        AsyncTask(ENamedThreads::GameThread, [WeakComponent, FilePath, bCreateCollision, OnLoaded, bSuccess, Mesh = MoveTemp(Mesh)]() mutable
+        {
+            UDynamicMeshComponent* Component = WeakComponent.Get();
+            if (!Component || !bSuccess)
+            {
+                UE_LOG(LogRuntimeMeshLoader, Error, TEXT("LoadMeshIntoDynamicMeshComponentAsync: Failed to load mesh from %s"), *FilePath);
+                OnLoaded.ExecuteIfBound(Component, false);
+                return;
+            }
+
+            ApplyDynamicMesh(Component, MoveTemp(Mesh), FilePath, bCreateCollision);
+            OnLoaded.ExecuteIfBound(Component, true);
+        });
+    });
+}
+
+UMaterialInstanceDynamic* URuntimeMeshLoaderHelper::CreateMaterialForMeshFile(FString FilePath)
+{
+    return CreateMaterialForMeshFile(FilePath, FOnMeshLoadProgress());
+}
+
+UMaterialInstanceDynamic* URuntimeMeshLoaderHelper::CreateMaterialForMeshFile(const FString& FilePath, const FOnMeshLoadProgress& OnProgress)
+{
     // Load textures
     FString BaseFilePath = FilePath;
     FString BaseName = FPaths::GetBaseFilename(BaseFilePath);
@@ -80,8 +580,11 @@ bool URuntimeMeshLoaderHelper::LoadMeshWithTextures(UProceduralMeshComponent* Pr
     bool bIsNormalValid = false;
     int32 Width = 0, Height = 0;
     
+    OnProgress.ExecuteIfBound(EMeshLoadStage::TextureDecode, 0.0f);
     UTexture2D* DiffuseTexture = UMeshLoader::LoadTexture2DFromFile(TexturePath, bIsTextureValid, Width, Height);
+    OnProgress.ExecuteIfBound(EMeshLoadStage::TextureDecode, 0.5f);
     UTexture2D* NormalTexture = UMeshLoader::LoadTexture2DFromFile(NormalPath, bIsNormalValid, Width, Height);
+    OnProgress.ExecuteIfBound(EMeshLoadStage::TextureDecode, 1.0f);
     
     // Create materials
     UMaterialInstanceDynamic* Material = nullptr;
@@ -101,7 +604,7 @@ bool URuntimeMeshLoaderHelper::LoadMeshWithTextures(UProceduralMeshComponent* Pr
         
         if (BaseMaterial)
         {
-            Material = UMaterialInstanceDynamic::Create(BaseMaterial, nullptr);
+            Material = CreateMaterialInstance(BaseMaterial);
             Material->SetVectorParameterValue(TEXT("Color"), FLinearColor(0.5f, 0.5f, 0.5f));
             
             // Try to enable two-sided rendering via material parameters
@@ -110,39 +613,7 @@ bool URuntimeMeshLoaderHelper::LoadMeshWithTextures(UProceduralMeshComponent* Pr
         }
     }
 
-    // Add mesh sections
-    int32 SectionIdx = 0;
-    for (const FNodeData& Node : ReturnData.Nodes)
-    {
-        for (const FMeshData& MeshData : Node.Meshes)
-        {
-            // Skip empty meshes
-            if (MeshData.Vertices.Num() == 0 || MeshData.Triangles.Num() == 0)
-            {
-                continue;
-            }
-            
-            ProceduralMeshComponent->CreateMeshSection(
-                SectionIdx,
-                MeshData.Vertices,
-                MeshData.Triangles,
-                MeshData.Normals,
-                MeshData.UVs,
-                TArray<FColor>(),
-                MeshData.Tangents,
-                true // Create collision
-            );
-            
-            if (Material)
-            {
-                ProceduralMeshComponent->SetMaterial(SectionIdx, Material);
-            }
-            
-            SectionIdx++;
-        }
-    }
-    
-    return true;
+    return Material;
 }
 
 UMaterialInstanceDynamic* URuntimeMeshLoaderHelper::CreateMaterialWithTextures(UTexture2D* DiffuseTexture, UTexture2D* NormalTexture)
@@ -177,7 +648,7 @@ UMaterialInstanceDynamic* URuntimeMeshLoaderHelper::CreateMaterialWithTextures(U
     }
     
     // Create a dynamic material instance
-    UMaterialInstanceDynamic* MaterialInstance = UMaterialInstanceDynamic::Create(BaseMaterial, nullptr);
+    UMaterialInstanceDynamic* MaterialInstance = CreateMaterialInstance(BaseMaterial);
     if (!MaterialInstance)
     {
         UE_LOG(LogRuntimeMeshLoader, Error, TEXT("CreateMaterialWithTextures: Failed to create material instance"));
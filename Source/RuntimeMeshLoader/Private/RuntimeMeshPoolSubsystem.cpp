@@ -0,0 +1,262 @@
+#include "RuntimeMeshPoolSubsystem.h"
+#include "RuntimeMeshLoader.h"
+#include "Engine/Engine.h"
+#include "GameFramework/Actor.h"
+
+namespace
+{
+	/** Number of tracked objects after which stale weak pointers are pruned */
+	constexpr int32 PruneThreshold = 256;
+}
+
+URuntimeMeshPoolSubsystem* URuntimeMeshPoolSubsystem::Get()
+{
+	return GEngine ? GEngine->GetEngineSubsystem<URuntimeMeshPoolSubsystem>() : nullptr;
+}
+
+void URuntimeMeshPoolSubsystem::Deinitialize()
+{
+	TrimPool();
+	AcquiredMaterials.Empty();
+	AcquiredTextures.Empty();
+	Super::Deinitialize();
+}
+
+UProceduralMeshComponent* URuntimeMeshPoolSubsystem::AcquireMeshComponent(AActor* Owner, USceneComponent* AttachParent)
+{
+	if (!Owner)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("AcquireMeshComponent: Invalid Owner"));
+		return nullptr;
+	}
+
+	Stats.ComponentsAcquired++;
+
+	UProceduralMeshComponent* Component = nullptr;
+	while (!Component && FreeComponents.Num() > 0)
+	{
+		Component = FreeComponents.Pop();
+		if (!IsValid(Component))
+		{
+			Component = nullptr;
+		}
+	}
+
+	if (Component)
+	{
+		Stats.ComponentsReused++;
+		Component->Rename(nullptr, Owner, REN_DontCreateRedirectors);
+		Component->SetRelativeTransform(FTransform::Identity);
+	}
+	else
+	{
+		Component = NewObject<UProceduralMeshComponent>(Owner, NAME_None, RF_Transient);
+	}
+
+	USceneComponent* Parent = AttachParent ? AttachParent : Owner->GetRootComponent();
+	if (Parent)
+	{
+		Component->SetupAttachment(Parent);
+	}
+	else
+	{
+		Owner->SetRootComponent(Component);
+	}
+
+	Owner->AddInstanceComponent(Component);
+	Component->RegisterComponent();
+	return Component;
+}
+
+void URuntimeMeshPoolSubsystem::ReleaseMeshComponent(UProceduralMeshComponent* Component, bool bReleaseMaterials)
+{
+	if (!IsValid(Component))
+	{
+		return;
+	}
+
+	if (bReleaseMaterials)
+	{
+		for (int32 MaterialIdx = 0; MaterialIdx < Component->GetNumMaterials(); MaterialIdx++)
+		{
+			UMaterialInstanceDynamic* MaterialInstance = Cast<UMaterialInstanceDynamic>(Component->GetMaterial(MaterialIdx));
+			if (MaterialInstance && AcquiredMaterials.Contains(MaterialInstance))
+			{
+				ReleaseMaterialInstance(MaterialInstance, true);
+			}
+		}
+	}
+
+	Component->ClearAllMeshSections();
+	Component->EmptyOverrideMaterials();
+
+	if (Component->IsRegistered())
+	{
+		Component->DetachFromComponent(FDetachmentTransformRules::KeepRelativeTransform);
+		Component->UnregisterComponent();
+	}
+
+	if (AActor* Owner = Component->GetOwner())
+	{
+		Owner->RemoveInstanceComponent(Component);
+	}
+
+	// Park the component outside of any actor until it is acquired again
+	Component->Rename(nullptr, this, REN_DontCreateRedirectors);
+	FreeComponents.AddUnique(Component);
+}
+
+UMaterialInstanceDynamic* URuntimeMeshPoolSubsystem::AcquireMaterialInstance(UMaterialInterface* Parent)
+{
+	if (!Parent)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("AcquireMaterialInstance: Invalid Parent material"));
+		return nullptr;
+	}
+
+	Stats.MaterialsAcquired++;
+
+	UMaterialInstanceDynamic* MaterialInstance = nullptr;
+	for (int32 Idx = FreeMaterials.Num() - 1; Idx >= 0; Idx--)
+	{
+		if (IsValid(FreeMaterials[Idx]) && FreeMaterials[Idx]->Parent == Parent)
+		{
+			MaterialInstance = FreeMaterials[Idx];
+			FreeMaterials.RemoveAtSwap(Idx);
+			break;
+		}
+	}
+
+	if (MaterialInstance)
+	{
+		Stats.MaterialsReused++;
+	}
+	else
+	{
+		MaterialInstance = UMaterialInstanceDynamic::Create(Parent, GetTransientPackage());
+	}
+
+	if (AcquiredMaterials.Num() > PruneThreshold)
+	{
+		PruneAcquired();
+	}
+	AcquiredMaterials.Add(MaterialInstance);
+	return MaterialInstance;
+}
+
+void URuntimeMeshPoolSubsystem::ReleaseMaterialInstance(UMaterialInstanceDynamic* MaterialInstance, bool bReleaseTextures)
+{
+	if (!IsValid(MaterialInstance) || AcquiredMaterials.Remove(MaterialInstance) == 0)
+	{
+		return;
+	}
+
+	if (bReleaseTextures)
+	{
+		for (const FTextureParameterValue& Parameter : MaterialInstance->TextureParameterValues)
+		{
+			UTexture2D* Texture = Cast<UTexture2D>(Parameter.ParameterValue);
+			if (Texture && AcquiredTextures.Contains(Texture))
+			{
+				ReleaseTexture(Texture);
+			}
+		}
+	}
+
+	MaterialInstance->ClearParameterValues();
+	FreeMaterials.Add(MaterialInstance);
+}
+
+UTexture2D* URuntimeMeshPoolSubsystem::AcquireTexture(int32 Width, int32 Height, EPixelFormat Format)
+{
+	Stats.TexturesAcquired++;
+
+	UTexture2D* Texture = nullptr;
+	for (int32 Idx = FreeTextures.Num() - 1; Idx >= 0; Idx--)
+	{
+		UTexture2D* Candidate = FreeTextures[Idx];
+		if (IsValid(Candidate) && Candidate->GetSizeX() == Width && Candidate->GetSizeY() == Height && Candidate->GetPixelFormat() == Format)
+		{
+			Texture = Candidate;
+			FreeTextures.RemoveAtSwap(Idx);
+			break;
+		}
+	}
+
+	if (Texture)
+	{
+		Stats.TexturesReused++;
+	}
+	else
+	{
+		Texture = UTexture2D::CreateTransient(Width, Height, Format);
+		if (!Texture)
+		{
+			return nullptr;
+		}
+	}
+
+	if (AcquiredTextures.Num() > PruneThreshold)
+	{
+		PruneAcquired();
+	}
+	AcquiredTextures.Add(Texture);
+	return Texture;
+}
+
+void URuntimeMeshPoolSubsystem::ReleaseTexture(UTexture2D* Texture)
+{
+	if (!IsValid(Texture) || AcquiredTextures.Remove(Texture) == 0)
+	{
+		return;
+	}
+
+	FreeTextures.Add(Texture);
+}
+
+void URuntimeMeshPoolSubsystem::TrimPool()
+{
+	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("RuntimeMeshPool: Trimming %d components, %d materials and %d textures"),
+		FreeComponents.Num(), FreeMaterials.Num(), FreeTextures.Num());
+
+	FreeComponents.Empty();
+	FreeMaterials.Empty();
+	FreeTextures.Empty();
+	PruneAcquired();
+}
+
+FRuntimeMeshPoolStats URuntimeMeshPoolSubsystem::GetStats() const
+{
+	FRuntimeMeshPoolStats Result = Stats;
+	Result.ComponentsPooled = FreeComponents.Num();
+	Result.MaterialsPooled = FreeMaterials.Num();
+	Result.TexturesPooled = FreeTextures.Num();
+
+	const int32 Acquired = Stats.ComponentsAcquired + Stats.MaterialsAcquired + Stats.TexturesAcquired;
+	const int32 Reused = Stats.ComponentsReused + Stats.MaterialsReused + Stats.TexturesReused;
+	Result.ReuseRate = Acquired > 0 ? (float)Reused / (float)Acquired : 0.0f;
+	return Result;
+}
+
+void URuntimeMeshPoolSubsystem::ResetStats()
+{
+	Stats = FRuntimeMeshPoolStats();
+}
+
+void URuntimeMeshPoolSubsystem::PruneAcquired()
+{
+	for (auto It = AcquiredMaterials.CreateIterator(); It; ++It)
+	{
+		if (!It->IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	for (auto It = AcquiredTextures.CreateIterator(); It; ++It)
+	{
+		if (!It->IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
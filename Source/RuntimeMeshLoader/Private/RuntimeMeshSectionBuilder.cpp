@@ -0,0 +1,284 @@
+#include "RuntimeMeshSectionBuilder.h"
+#include "RuntimeMeshLoader.h"
+#include "RuntimeMeshLoaderHelper.h"
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+
+URuntimeMeshSectionBuilder* URuntimeMeshSectionBuilder::BuildMeshSections(UProceduralMeshComponent* ProceduralMeshComponent,
+                                                                          const FFinalReturnData& MeshData,
+                                                                          UMaterialInterface* Material,
+                                                                          FMeshSectionBuildSettings Settings,
+                                                                          bool bClearMesh)
+{
+	if (!ProceduralMeshComponent)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("BuildMeshSections: Invalid ProceduralMeshComponent"));
+		return nullptr;
+	}
+
+	URuntimeMeshSectionBuilder* Builder = NewObject<URuntimeMeshSectionBuilder>();
+	Builder->Begin(ProceduralMeshComponent, Settings, bClearMesh);
+	Builder->StartSections(FFinalReturnData(MeshData), Material);
+	return Builder;
+}
+
+URuntimeMeshSectionBuilder* URuntimeMeshSectionBuilder::LoadMeshWithTexturesTimeSliced(UProceduralMeshComponent* ProceduralMeshComponent,
+                                                                                       FString FilePath,
+                                                                                       EPathType Type,
+                                                                                       FMeshSectionBuildSettings Settings,
+                                                                                       bool bClearMesh)
+{
+	if (!ProceduralMeshComponent)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("LoadMeshWithTexturesTimeSliced: Invalid ProceduralMeshComponent"));
+		return nullptr;
+	}
+
+	URuntimeMeshSectionBuilder* Builder = NewObject<URuntimeMeshSectionBuilder>();
+	Builder->Begin(ProceduralMeshComponent, Settings, bClearMesh);
+	Builder->Phase = EBuildPhase::Importing;
+	Builder->ImportCancellation = MakeShared<FMeshLoadCancellationToken>();
+	Builder->ImportProgress = MakeShared<FImportProgress>();
+
+	FMeshImportOptions Options;
+	Options.bPrefetchTextures = true;
+	Options.CancellationToken = Builder->ImportCancellation;
+	Options.OnProgress.BindLambda([Progress = Builder->ImportProgress](EMeshLoadStage Stage, float Value)
+	{
+		Progress->Stage = Stage;
+		Progress->Progress = Value;
+	});
+
+	TWeakObjectPtr<URuntimeMeshSectionBuilder> WeakBuilder(Builder);
+	Async(EAsyncExecution::ThreadPool, [WeakBuilder, FilePath, Type, Options]()
+	{
+		FFinalReturnData ReturnData = UMeshLoader::LoadMeshFromFileWithOptions(FilePath, Type, Options);
+
+		// Textures and materials are UObjects, so they have to be created on the game thread
+		AsyncTask(ENamedThreads::GameThread, [WeakBuilder, FilePath, Type, ReturnData = MoveTemp(ReturnData)]() mutable
+		{
+			URuntimeMeshSectionBuilder* Builder = WeakBuilder.Get();
+			if (!Builder || Builder->Phase != EBuildPhase::Importing)
+			{
+				// Cancelled while the import was running
+				return;
+			}
+
+			if (!ReturnData.Success)
+			{
+				UE_LOG(LogRuntimeMeshLoader, Error, TEXT("LoadMeshWithTexturesTimeSliced: Failed to load mesh from %s"), *FilePath);
+				Builder->Finish(false);
+				return;
+			}
+
+			FString TextureBasePath = FilePath;
+			if (Type == EPathType::Relative)
+			{
+				TextureBasePath = FPaths::Combine(FPaths::ProjectContentDir(), FilePath);
+			}
+
+			UMaterialInstanceDynamic* Material = URuntimeMeshLoaderHelper::CreateMaterialForMeshFile(TextureBasePath,
+				FOnMeshLoadProgress::CreateUObject(Builder, &URuntimeMeshSectionBuilder::BroadcastImportProgress));
+
+			Builder->ImportCancellation.Reset();
+			Builder->ImportProgress.Reset();
+			Builder->StartSections(MoveTemp(ReturnData), Material);
+		});
+	});
+
+	return Builder;
+}
+
+void URuntimeMeshSectionBuilder::Begin(UProceduralMeshComponent* ProceduralMeshComponent, const FMeshSectionBuildSettings& InSettings, bool bInClearMesh)
+{
+	TargetComponent = ProceduralMeshComponent;
+	Settings = InSettings;
+	Settings.FrameBudgetMs = FMath::Max(Settings.FrameBudgetMs, 0.1f);
+	bClearMesh = bInClearMesh;
+
+	// Nothing else references the builder while it runs, keep it alive until it is finished
+	AddToRoot();
+}
+
+void URuntimeMeshSectionBuilder::StartSections(FFinalReturnData&& InMeshData, UMaterialInterface* InMaterial)
+{
+	PendingData = MoveTemp(InMeshData);
+	Material = InMaterial;
+
+	WorkItems.Reset();
+	for (int32 NodeIdx = 0; NodeIdx < PendingData.Nodes.Num(); NodeIdx++)
+	{
+		const TArray<FMeshData>& Meshes = PendingData.Nodes[NodeIdx].Meshes;
+		for (int32 MeshIdx = 0; MeshIdx < Meshes.Num(); MeshIdx++)
+		{
+			// Skip empty meshes
+			if (Meshes[MeshIdx].Vertices.Num() == 0 || Meshes[MeshIdx].Triangles.Num() == 0)
+			{
+				continue;
+			}
+			WorkItems.Add(TPair<int32, int32>(NodeIdx, MeshIdx));
+		}
+	}
+
+	NextWorkItem = 0;
+	SectionCount = 0;
+	Phase = EBuildPhase::Sections;
+
+	UProceduralMeshComponent* Component = TargetComponent.Get();
+	if (Component)
+	{
+		if (bClearMesh)
+		{
+			Component->ClearAllMeshSections();
+		}
+		Component->bUseAsyncCooking = Settings.bAsyncCollisionCooking;
+	}
+
+	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("RuntimeMeshSectionBuilder: Building %d sections with a budget of %.2f ms per frame"),
+		WorkItems.Num(), Settings.FrameBudgetMs);
+}
+
+void URuntimeMeshSectionBuilder::Tick(float DeltaTime)
+{
+	if (Phase == EBuildPhase::Importing)
+	{
+		if (ImportProgress)
+		{
+			BroadcastImportProgress(ImportProgress->Stage, ImportProgress->Progress);
+		}
+		return;
+	}
+
+	if (!TargetComponent.IsValid())
+	{
+		UE_LOG(LogRuntimeMeshLoader, Warning, TEXT("RuntimeMeshSectionBuilder: Target component was destroyed, stopping build"));
+		Finish(false);
+		return;
+	}
+
+	const double Deadline = FPlatformTime::Seconds() + Settings.FrameBudgetMs / 1000.0;
+
+	// Always make progress, even if a single section exceeds the budget
+	while (NextWorkItem < WorkItems.Num())
+	{
+		BuildNextSection();
+		if (FPlatformTime::Seconds() >= Deadline)
+		{
+			break;
+		}
+	}
+
+	if (NextWorkItem >= WorkItems.Num())
+	{
+		Finish(true);
+	}
+}
+
+void URuntimeMeshSectionBuilder::BuildNextSection()
+{
+	UProceduralMeshComponent* Component = TargetComponent.Get();
+	const TPair<int32, int32>& Item = WorkItems[NextWorkItem++];
+	FMeshData& MeshData = PendingData.Nodes[Item.Key].Meshes[Item.Value];
+
+	// CreateMeshSection re-cooks the collision of every flagged section, so collision is only requested
+	// for the last section, after flagging all previous ones. That results in a single cook for the model.
+	const bool bLastSection = NextWorkItem == WorkItems.Num();
+	if (bLastSection && Settings.bCreateCollision)
+	{
+		for (int32 Idx = 0; Idx < SectionCount; Idx++)
+		{
+			if (FProcMeshSection* Section = Component->GetProcMeshSection(Idx))
+			{
+				Section->bEnableCollision = true;
+			}
+		}
+	}
+
+	Component->CreateMeshSection(
+		SectionCount,
+		MeshData.Vertices,
+		MeshData.Triangles,
+		MeshData.Normals,
+		MeshData.UVs,
+		TArray<FColor>(),
+		MeshData.Tangents,
+		bLastSection && Settings.bCreateCollision
+	);
+
+	if (Material)
+	{
+		Component->SetMaterial(SectionCount, Material);
+	}
+
+	// The component holds its own copy of the section now
+	MeshData = FMeshData();
+	SectionCount++;
+}
+
+void URuntimeMeshSectionBuilder::Cancel()
+{
+	if (ImportCancellation)
+	{
+		ImportCancellation->Cancel();
+	}
+
+	if (IsBuilding())
+	{
+		Finish(false);
+	}
+}
+
+bool URuntimeMeshSectionBuilder::IsBuilding() const
+{
+	return Phase != EBuildPhase::Idle;
+}
+
+float URuntimeMeshSectionBuilder::GetProgress() const
+{
+	if (Phase == EBuildPhase::Importing)
+	{
+		return 0.0f;
+	}
+	return WorkItems.Num() > 0 ? (float)NextWorkItem / (float)WorkItems.Num() : 1.0f;
+}
+
+void URuntimeMeshSectionBuilder::Finish(bool bSuccess)
+{
+	Phase = EBuildPhase::Idle;
+	PendingData = FFinalReturnData();
+	WorkItems.Empty();
+	ImportCancellation.Reset();
+	ImportProgress.Reset();
+
+	UE_LOG(LogRuntimeMeshLoader, Log, TEXT("RuntimeMeshSectionBuilder: Finished with %d sections (Success: %s)"),
+		SectionCount, bSuccess ? TEXT("Yes") : TEXT("No"));
+
+	OnBuildComplete.Broadcast(TargetComponent.Get(), bSuccess);
+	RemoveFromRoot();
+}
+
+void URuntimeMeshSectionBuilder::BroadcastImportProgress(EMeshLoadStage Stage, float Progress)
+{
+	if (Stage != ReportedStage || Progress != ReportedProgress)
+	{
+		ReportedStage = Stage;
+		ReportedProgress = Progress;
+		OnImportProgress.Broadcast(Stage, Progress);
+	}
+}
+
+bool URuntimeMeshSectionBuilder::IsTickable() const
+{
+	return Phase != EBuildPhase::Idle;
+}
+
+ETickableTickType URuntimeMeshSectionBuilder::GetTickableTickType() const
+{
+	return HasAnyFlags(RF_ClassDefaultObject) ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+TStatId URuntimeMeshSectionBuilder::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URuntimeMeshSectionBuilder, STATGROUP_Tickables);
+}
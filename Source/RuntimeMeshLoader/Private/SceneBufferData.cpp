@@ -0,0 +1,289 @@
+#include "SceneBufferData.h"
+#include "RuntimeMeshLoader.h"
+#include "Async/ParallelFor.h"
+
+// Bump whenever the serialized layout changes
+static constexpr uint32 SceneBufferDataVersion = 3;
+
+SIZE_T FSceneBufferData::GetAllocatedSize() const
+{
+	return Nodes.GetAllocatedSize() + Meshes.GetAllocatedSize() + Positions.GetAllocatedSize() + Normals.GetAllocatedSize()
+		+ UVs.GetAllocatedSize() + Tangents.GetAllocatedSize() + Indices16.GetAllocatedSize() + Indices.GetAllocatedSize();
+}
+
+void FSceneBufferData::ToMeshData(int32 MeshIndex, FMeshData& OutMesh) const
+{
+	const FSceneBufferMesh& Mesh = Meshes[MeshIndex];
+	const EMeshAttributes Attributes = (EMeshAttributes)Mesh.Attributes;
+	const int32 NumVertices = (int32)Mesh.NumVertices;
+
+	OutMesh.Vertices.SetNumUninitialized(NumVertices);
+	OutMesh.Normals.SetNumUninitialized(EnumHasAnyFlags(Attributes, EMeshAttributes::Normals) ? NumVertices : 0);
+	OutMesh.UVs.SetNumUninitialized(EnumHasAnyFlags(Attributes, EMeshAttributes::UVs) ? NumVertices : 0);
+	OutMesh.Tangents.SetNumUninitialized(EnumHasAnyFlags(Attributes, EMeshAttributes::Tangents) ? NumVertices : 0);
+	OutMesh.Attributes = Mesh.Attributes;
+
+	for (int32 i = 0; i < NumVertices; i++)
+	{
+		OutMesh.Vertices[i] = FVector(Positions[Mesh.FirstVertex + i]);
+	}
+	for (int32 i = 0; i < OutMesh.Normals.Num(); i++)
+	{
+		OutMesh.Normals[i] = FVector(Normals[Mesh.FirstVertex + i]);
+	}
+	for (int32 i = 0; i < OutMesh.UVs.Num(); i++)
+	{
+		OutMesh.UVs[i] = FVector2D(UVs[Mesh.FirstVertex + i]);
+	}
+	for (int32 i = 0; i < OutMesh.Tangents.Num(); i++)
+	{
+		const FVector4f& Tangent = Tangents[Mesh.FirstVertex + i];
+		OutMesh.Tangents[i] = FProcMeshTangent(FVector(Tangent.X, Tangent.Y, Tangent.Z), Tangent.W < 0.0f);
+	}
+
+	OutMesh.Triangles.SetNumUninitialized((int32)Mesh.NumIndices);
+	for (int32 i = 0; i < (int32)Mesh.NumIndices; i++)
+	{
+		OutMesh.Triangles[i] = (int32)GetIndex(MeshIndex, i);
+	}
+}
+
+void FSceneBufferData::ToProcMeshSection(int32 MeshIndex, FProcMeshSection& OutSection) const
+{
+	const FSceneBufferMesh& Mesh = Meshes[MeshIndex];
+	const EMeshAttributes Attributes = (EMeshAttributes)Mesh.Attributes;
+	const bool bNormals = EnumHasAnyFlags(Attributes, EMeshAttributes::Normals);
+	const bool bUVs = EnumHasAnyFlags(Attributes, EMeshAttributes::UVs);
+	const bool bTangents = EnumHasAnyFlags(Attributes, EMeshAttributes::Tangents);
+
+	// The ranges of absent attributes already hold the FProcMeshVertex defaults, skipping them only saves the copy
+	OutSection.Reset();
+	OutSection.ProcVertexBuffer.SetNum((int32)Mesh.NumVertices);
+	OutSection.SectionLocalBox = FBox(ForceInit);
+	for (int32 i = 0; i < (int32)Mesh.NumVertices; i++)
+	{
+		const uint32 Source = Mesh.FirstVertex + i;
+		FProcMeshVertex& Vertex = OutSection.ProcVertexBuffer[i];
+		Vertex.Position = FVector(Positions[Source]);
+		OutSection.SectionLocalBox += Vertex.Position;
+
+		if (bNormals)
+		{
+			Vertex.Normal = FVector(Normals[Source]);
+		}
+		if (bUVs)
+		{
+			Vertex.UV0 = FVector2D(UVs[Source]);
+		}
+		if (bTangents)
+		{
+			const FVector4f& Tangent = Tangents[Source];
+			Vertex.Tangent = FProcMeshTangent(FVector(Tangent.X, Tangent.Y, Tangent.Z), Tangent.W < 0.0f);
+		}
+	}
+
+	OutSection.ProcIndexBuffer.SetNumUninitialized((int32)Mesh.NumIndices);
+	for (int32 i = 0; i < (int32)Mesh.NumIndices; i++)
+	{
+		OutSection.ProcIndexBuffer[i] = GetIndex(MeshIndex, i);
+	}
+}
+
+FSceneBufferData FSceneBufferData::FromReturnData(FFinalReturnData&& ReturnData)
+{
+	FSceneBufferData SceneData;
+	SceneData.Memory = ReturnData.Memory;
+
+	// Lay out the node and mesh tables first, so every buffer is allocated exactly once
+	TArray<FMeshData*> SourceMeshes;
+	int64 NumVertices = 0;
+	int64 NumIndices16 = 0;
+	int64 NumIndices32 = 0;
+	EMeshAttributes SceneAttributes = EMeshAttributes::None;
+
+	SceneData.Nodes.Reserve(ReturnData.Nodes.Num());
+	for (int32 NodeIndex = 0; NodeIndex < ReturnData.Nodes.Num(); NodeIndex++)
+	{
+		FNodeData& Node = ReturnData.Nodes[NodeIndex];
+		FSceneBufferNode& BufferNode = SceneData.Nodes.AddDefaulted_GetRef();
+		BufferNode.RelativeTransform = Node.RelativeTransformTransform;
+		BufferNode.NodeParentIndex = Node.NodeParentIndex;
+		BufferNode.FirstMesh = SceneData.Meshes.Num();
+		BufferNode.NumMeshes = Node.Meshes.Num();
+
+		for (FMeshData& Mesh : Node.Meshes)
+		{
+			const int32 MeshVertices = Mesh.Vertices.Num();
+
+			FSceneBufferMesh& BufferMesh = SceneData.Meshes.AddDefaulted_GetRef();
+			BufferMesh.NodeIndex = NodeIndex;
+			BufferMesh.FirstVertex = (uint32)NumVertices;
+			BufferMesh.NumVertices = (uint32)MeshVertices;
+			BufferMesh.NumIndices = (uint32)Mesh.Triangles.Num();
+			// Indices are relative to their mesh, so the mesh size decides whether 16 bits are enough
+			BufferMesh.b16BitIndices = MeshVertices <= MAX_uint16 + 1;
+			int64& NumIndices = BufferMesh.b16BitIndices ? NumIndices16 : NumIndices32;
+			BufferMesh.FirstIndex = (uint32)NumIndices;
+			NumIndices += Mesh.Triangles.Num();
+
+			EMeshAttributes Attributes = EMeshAttributes::None;
+			if (Mesh.Normals.Num() == MeshVertices) Attributes |= EMeshAttributes::Normals;
+			if (Mesh.UVs.Num() == MeshVertices) Attributes |= EMeshAttributes::UVs;
+			if (Mesh.Tangents.Num() == MeshVertices) Attributes |= EMeshAttributes::Tangents;
+			BufferMesh.Attributes = (uint8)Attributes;
+			SceneAttributes |= Attributes;
+
+			SourceMeshes.Add(&Mesh);
+			NumVertices += MeshVertices;
+		}
+	}
+
+	if (NumVertices > MAX_int32 || NumIndices16 > MAX_int32 || NumIndices32 > MAX_int32)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Scene is too large for scene buffers (%lld vertices, %lld indices)"), NumVertices, NumIndices16 + NumIndices32);
+		ReturnData = FFinalReturnData();
+		return FSceneBufferData();
+	}
+
+	SceneData.Positions.SetNumUninitialized((int32)NumVertices);
+	SceneData.Normals.SetNumUninitialized(EnumHasAnyFlags(SceneAttributes, EMeshAttributes::Normals) ? (int32)NumVertices : 0);
+	SceneData.UVs.SetNumUninitialized(EnumHasAnyFlags(SceneAttributes, EMeshAttributes::UVs) ? (int32)NumVertices : 0);
+	SceneData.Tangents.SetNumUninitialized(EnumHasAnyFlags(SceneAttributes, EMeshAttributes::Tangents) ? (int32)NumVertices : 0);
+	SceneData.Indices16.SetNumUninitialized((int32)NumIndices16);
+	SceneData.Indices.SetNumUninitialized((int32)NumIndices32);
+
+	// Every mesh writes its own ranges, so meshes can be copied in parallel
+	ParallelFor(SourceMeshes.Num(), [&SceneData, &SourceMeshes](int32 MeshIndex)
+	{
+		FMeshData& Mesh = *SourceMeshes[MeshIndex];
+		const FSceneBufferMesh& BufferMesh = SceneData.Meshes[MeshIndex];
+		const EMeshAttributes Attributes = (EMeshAttributes)BufferMesh.Attributes;
+		const int32 First = (int32)BufferMesh.FirstVertex;
+
+		for (int32 i = 0; i < Mesh.Vertices.Num(); i++)
+		{
+			SceneData.Positions[First + i] = FVector3f(Mesh.Vertices[i]);
+		}
+
+		// Meshes without an attribute get the values CreateMeshSection would use for them
+		if (SceneData.Normals.Num() > 0)
+		{
+			const bool bHasNormals = EnumHasAnyFlags(Attributes, EMeshAttributes::Normals);
+			for (int32 i = 0; i < Mesh.Vertices.Num(); i++)
+			{
+				SceneData.Normals[First + i] = bHasNormals ? FVector3f(Mesh.Normals[i]) : FVector3f(0.0f, 0.0f, 1.0f);
+			}
+		}
+		if (SceneData.UVs.Num() > 0)
+		{
+			const bool bHasUVs = EnumHasAnyFlags(Attributes, EMeshAttributes::UVs);
+			for (int32 i = 0; i < Mesh.Vertices.Num(); i++)
+			{
+				SceneData.UVs[First + i] = bHasUVs ? FVector2f(Mesh.UVs[i]) : FVector2f(0.0f, 0.0f);
+			}
+		}
+		if (SceneData.Tangents.Num() > 0)
+		{
+			const bool bHasTangents = EnumHasAnyFlags(Attributes, EMeshAttributes::Tangents);
+			for (int32 i = 0; i < Mesh.Vertices.Num(); i++)
+			{
+				SceneData.Tangents[First + i] = bHasTangents
+					? FVector4f(FVector3f(Mesh.Tangents[i].TangentX), Mesh.Tangents[i].bFlipTangentY ? -1.0f : 1.0f)
+					: FVector4f(1.0f, 0.0f, 0.0f, 1.0f);
+			}
+		}
+
+		for (int32 i = 0; i < Mesh.Triangles.Num(); i++)
+		{
+			if (BufferMesh.b16BitIndices)
+			{
+				SceneData.Indices16[BufferMesh.FirstIndex + i] = (uint16)Mesh.Triangles[i];
+			}
+			else
+			{
+				SceneData.Indices[BufferMesh.FirstIndex + i] = (uint32)Mesh.Triangles[i];
+			}
+		}
+
+		// Free each source mesh right away, so the scene never exists twice in full
+		Mesh = FMeshData();
+	});
+
+	SceneData.Success = ReturnData.Success;
+	ReturnData = FFinalReturnData();
+	return SceneData;
+}
+
+static FArchive& operator<<(FArchive& Ar, FSceneBufferNode& Node)
+{
+	Ar << Node.RelativeTransform << Node.NodeParentIndex << Node.FirstMesh << Node.NumMeshes;
+	return Ar;
+}
+
+static FArchive& operator<<(FArchive& Ar, FSceneBufferMesh& Mesh)
+{
+	Ar << Mesh.NodeIndex << Mesh.FirstVertex << Mesh.NumVertices << Mesh.FirstIndex << Mesh.NumIndices << Mesh.b16BitIndices << Mesh.Attributes;
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FSceneBufferData& Data)
+{
+	uint32 Version = SceneBufferDataVersion;
+	Ar << Version;
+	if (Version != SceneBufferDataVersion)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Unsupported scene buffer version %u"), Version);
+		Ar.SetError();
+		return Ar;
+	}
+
+	Ar << Data.Success;
+	Ar << Data.Nodes;
+	Ar << Data.Meshes;
+	Data.Positions.BulkSerialize(Ar);
+	Data.Normals.BulkSerialize(Ar);
+	Data.UVs.BulkSerialize(Ar);
+	Data.Tangents.BulkSerialize(Ar);
+	Data.Indices16.BulkSerialize(Ar);
+	Data.Indices.BulkSerialize(Ar);
+
+	if (Ar.IsLoading())
+	{
+		// Reject data whose ranges, attribute flags or node references point outside the buffers and tables
+		// instead of reading out of bounds later
+		bool bValid = !Ar.IsError()
+			&& (Data.Normals.Num() == 0 || Data.Normals.Num() == Data.Positions.Num())
+			&& (Data.UVs.Num() == 0 || Data.UVs.Num() == Data.Positions.Num())
+			&& (Data.Tangents.Num() == 0 || Data.Tangents.Num() == Data.Positions.Num());
+		for (int32 MeshIndex = 0; bValid && MeshIndex < Data.Meshes.Num(); MeshIndex++)
+		{
+			const FSceneBufferMesh& Mesh = Data.Meshes[MeshIndex];
+			const EMeshAttributes Attributes = (EMeshAttributes)Mesh.Attributes;
+			const int32 NumIndices = Mesh.b16BitIndices ? Data.Indices16.Num() : Data.Indices.Num();
+			bValid = Data.Nodes.IsValidIndex(Mesh.NodeIndex)
+				&& (!EnumHasAnyFlags(Attributes, EMeshAttributes::Normals) || Data.Normals.Num() > 0)
+				&& (!EnumHasAnyFlags(Attributes, EMeshAttributes::UVs) || Data.UVs.Num() > 0)
+				&& (!EnumHasAnyFlags(Attributes, EMeshAttributes::Tangents) || Data.Tangents.Num() > 0)
+				&& (uint64)Mesh.FirstVertex + Mesh.NumVertices <= (uint64)Data.Positions.Num()
+				&& (uint64)Mesh.FirstIndex + Mesh.NumIndices <= (uint64)NumIndices;
+			for (uint32 i = 0; bValid && i < Mesh.NumIndices; i++)
+			{
+				bValid = Data.GetIndex(MeshIndex, i) < Mesh.NumVertices;
+			}
+		}
+		for (const FSceneBufferNode& Node : Data.Nodes)
+		{
+			bValid = bValid && Node.FirstMesh >= 0 && Node.NumMeshes >= 0 && (int64)Node.FirstMesh + Node.NumMeshes <= Data.Meshes.Num()
+				&& (Node.NodeParentIndex == INDEX_NONE || Data.Nodes.IsValidIndex(Node.NodeParentIndex));
+		}
+
+		if (!bValid)
+		{
+			UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Scene buffer data is corrupt"));
+			Ar.SetError();
+			Data = FSceneBufferData();
+		}
+	}
+
+	return Ar;
+}
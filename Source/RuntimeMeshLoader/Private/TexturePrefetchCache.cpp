@@ -0,0 +1,201 @@
+#include "TexturePrefetchCache.h"
+#include "RuntimeMeshLoader.h"
+#include "ZipBundle.h"
+#include "Async/Async.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/ScopeLock.h"
+#include "Modules/ModuleManager.h"
+
+namespace
+{
+	/** Prefetched textures nobody asked for are dropped this many seconds after they and their load are done */
+	constexpr double PrefetchExpirySeconds = 30.0;
+}
+
+FTexturePrefetchCache& FTexturePrefetchCache::Get()
+{
+	static FTexturePrefetchCache Instance;
+	return Instance;
+}
+
+void FTexturePrefetchCache::Prefetch(const FString& Path)
+{
+	const FString Key = MakeKey(Path);
+	const FFileStamp Stamp = GetFileStamp(Path);
+
+	FScopeLock Lock(&CriticalSection);
+
+	// A pending result of an older version of the file is replaced, a current one belongs to the new load now
+	FPendingTexture* Existing = Pending.Find(Key);
+	if (Existing && Existing->Stamp == Stamp)
+	{
+		Existing->bLoadFinished = false;
+		Existing->IdleSince = 0.0;
+		return;
+	}
+
+	FPendingTexture& Entry = Pending.Add(Key);
+	Entry.Stamp = Stamp;
+	Entry.Result = Async(EAsyncExecution::ThreadPool, [Path]()
+	{
+		return Decode(Path);
+	});
+
+	if (!ExpiryTickerHandle.IsValid())
+	{
+		ExpiryTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FTexturePrefetchCache::ExpireTextures), 1.0f);
+	}
+}
+
+void FTexturePrefetchCache::OnLoadFinished(const FString& Path)
+{
+	FScopeLock Lock(&CriticalSection);
+	if (FPendingTexture* Entry = Pending.Find(MakeKey(Path)))
+	{
+		Entry->bLoadFinished = true;
+	}
+}
+
+bool FTexturePrefetchCache::ExpireTextures(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	FScopeLock Lock(&CriticalSection);
+	for (auto It = Pending.CreateIterator(); It; ++It)
+	{
+		// Only results that are ready and whose load is over are waiting for a caller, anything else is still in use
+		FPendingTexture& Entry = It->Value;
+		if (!Entry.bLoadFinished || !Entry.Result.IsReady())
+		{
+			continue;
+		}
+
+		if (Entry.IdleSince == 0.0)
+		{
+			Entry.IdleSince = Now;
+		}
+		else if (Now - Entry.IdleSince > PrefetchExpirySeconds)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	if (Pending.Num() == 0)
+	{
+		ExpiryTickerHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+bool FTexturePrefetchCache::Take(const FString& Path, TSharedPtr<FDecodedTexture>& OutTexture)
+{
+	TFuture<TSharedPtr<FDecodedTexture>> Result;
+	{
+		FScopeLock Lock(&CriticalSection);
+		FPendingTexture* Entry = Pending.Find(MakeKey(Path));
+		if (!Entry)
+		{
+			return false;
+		}
+		const bool bStale = !(Entry->Stamp == GetFileStamp(Path));
+		Result = MoveTemp(Entry->Result);
+		Pending.Remove(MakeKey(Path));
+
+		// The file changed after it was prefetched, the caller decodes the current version
+		if (bStale)
+		{
+			return false;
+		}
+	}
+
+	// Usually done already, the decode overlapped with parsing the mesh
+	OutTexture = Result.Get();
+	return true;
+}
+
+TSharedPtr<FDecodedTexture> FTexturePrefetchCache::Decode(const FString& Path)
+{
+	// Load the compressed bytes, from a zip bundle if the path points into one
+	TArray<uint8> FileData;
+	if (!FZipBundle::LoadFileToArray(Path, FileData))
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Failed to load texture file to array: %s"), *Path);
+		return nullptr;
+	}
+
+	// Detect the image type using the file extension
+	EImageFormat DetectedFormat = EImageFormat::Invalid;
+
+	if (Path.EndsWith(".png", ESearchCase::IgnoreCase))
+	{
+		DetectedFormat = EImageFormat::PNG;
+	}
+	else if (Path.EndsWith(".jpg", ESearchCase::IgnoreCase) || Path.EndsWith(".jpeg", ESearchCase::IgnoreCase))
+	{
+		DetectedFormat = EImageFormat::JPEG;
+	}
+	else if (Path.EndsWith(".bmp", ESearchCase::IgnoreCase))
+	{
+		DetectedFormat = EImageFormat::BMP;
+	}
+
+	if (DetectedFormat == EImageFormat::Invalid)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Unsupported texture format for file: %s"), *Path);
+		return nullptr;
+	}
+
+	// The module is loaded on startup, so it can be looked up from worker threads
+	IImageWrapperModule& ImageWrapperModule = FModuleManager::GetModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+	TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(DetectedFormat);
+
+	if (!ImageWrapper.IsValid())
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Failed to create image wrapper for format: %d"), (int32)DetectedFormat);
+		return nullptr;
+	}
+
+	if (!ImageWrapper->SetCompressed(FileData.GetData(), FileData.Num()))
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Failed to set compressed data for image: %s"), *Path);
+		return nullptr;
+	}
+
+	TSharedPtr<FDecodedTexture> Texture = MakeShared<FDecodedTexture>();
+	if (!ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, Texture->Pixels))
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Failed to get raw image data: %s"), *Path);
+		return nullptr;
+	}
+
+	Texture->Width = ImageWrapper->GetWidth();
+	Texture->Height = ImageWrapper->GetHeight();
+	return Texture;
+}
+
+FTexturePrefetchCache::FFileStamp FTexturePrefetchCache::GetFileStamp(const FString& Path)
+{
+	FString StatPath = Path;
+	FString EntryName;
+	FZipBundle::SplitPath(Path, StatPath, EntryName);
+
+	const FFileStatData StatData = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*StatPath);
+	FFileStamp Stamp;
+	if (StatData.bIsValid)
+	{
+		Stamp.ModificationTime = StatData.ModificationTime;
+		Stamp.Size = StatData.FileSize;
+	}
+	return Stamp;
+}
+
+FString FTexturePrefetchCache::MakeKey(const FString& Path)
+{
+	FString Key = FPaths::ConvertRelativePathToFull(Path);
+	FPaths::NormalizeFilename(Key);
+	return Key;
+}
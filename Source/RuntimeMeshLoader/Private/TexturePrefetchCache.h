@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+
+/** Texture decoded to BGRA8 pixels, ready to be copied into a UTexture2D on the game thread */
+struct FDecodedTexture
+{
+	TArray<uint8> Pixels;
+	int32 Width = 0;
+	int32 Height = 0;
+};
+
+/**
+ * Reads and decodes the textures of a mesh on worker threads while the mesh itself is still being parsed.
+ * UMeshLoader::LoadTexture2DFromFile takes prefetched results from here instead of loading the file again.
+ * Results are tied to the size and modification time of the file, so an edited texture is decoded again.
+ * Results that are not picked up are dropped by a core ticker a while after both the decode and the load that
+ * prefetched them are done, so a long parse never loses its textures.
+ */
+class FTexturePrefetchCache
+{
+public:
+	static FTexturePrefetchCache& Get();
+
+	/** Starts reading and decoding Path on the thread pool, does nothing if the same version of the file is already pending */
+	void Prefetch(const FString& Path);
+
+	/** Called when the load that prefetched Path is done, the expiry of an unclaimed result starts from here */
+	void OnLoadFinished(const FString& Path);
+
+	/**
+	 * Removes a prefetched texture from the cache, waiting for the decode if it is still running
+	 *
+	 * @return false if Path was not prefetched or changed since, OutTexture is null if the decode failed
+	 */
+	bool Take(const FString& Path, TSharedPtr<FDecodedTexture>& OutTexture);
+
+	/** Reads and decodes a PNG, JPEG or BMP file (also inside zip bundles), safe to call from any thread */
+	static TSharedPtr<FDecodedTexture> Decode(const FString& Path);
+
+private:
+	/** Identifies a version of a file, for paths inside a zip bundle the archive is checked */
+	struct FFileStamp
+	{
+		FDateTime ModificationTime;
+		int64 Size = -1;
+
+		bool operator==(const FFileStamp& Other) const { return ModificationTime == Other.ModificationTime && Size == Other.Size; }
+	};
+
+	struct FPendingTexture
+	{
+		TFuture<TSharedPtr<FDecodedTexture>> Result;
+		FFileStamp Stamp;
+		bool bLoadFinished = false;
+		// First expiry tick that saw the decode and the load done, 0 until then
+		double IdleSince = 0.0;
+	};
+
+	static FString MakeKey(const FString& Path);
+	static FFileStamp GetFileStamp(const FString& Path);
+
+	/** Drops results nobody picked up, unregisters itself once the cache is empty */
+	bool ExpireTextures(float DeltaTime);
+
+	FCriticalSection CriticalSection;
+	TMap<FString, FPendingTexture> Pending;
+	FTSTicker::FDelegateHandle ExpiryTickerHandle;
+};
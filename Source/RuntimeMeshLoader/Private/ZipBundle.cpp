@@ -0,0 +1,514 @@
+#include "ZipBundle.h"
+#include "RuntimeMeshLoader.h"
+#include "Async/Async.h"
+#include "PlatformFileIOSystem.h"
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include <assimp/MemoryIOWrapper.h>
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+namespace
+{
+	constexpr uint32 EndOfCentralDirectorySignature = 0x06054b50;
+	constexpr uint32 CentralDirectorySignature = 0x02014b50;
+	constexpr uint32 LocalHeaderSignature = 0x04034b50;
+
+	constexpr int32 EndOfCentralDirectorySize = 22;
+	constexpr int32 CentralDirectoryHeaderSize = 46;
+	constexpr int32 LocalHeaderSize = 30;
+
+	constexpr uint16 MethodStored = 0;
+	constexpr uint16 MethodDeflated = 8;
+
+	uint16 ReadU16(const uint8* Data)
+	{
+		return (uint16)(Data[0] | (Data[1] << 8));
+	}
+
+	uint32 ReadU32(const uint8* Data)
+	{
+		return (uint32)Data[0] | ((uint32)Data[1] << 8) | ((uint32)Data[2] << 16) | ((uint32)Data[3] << 24);
+	}
+
+	bool ReadAt(IFileHandle& Handle, int64 Offset, uint8* Destination, int64 Size)
+	{
+		return Handle.Seek(Offset) && Handle.Read(Destination, Size);
+	}
+}
+
+TSharedPtr<FZipBundle> FZipBundle::Open(const FString& ArchivePath)
+{
+	TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*ArchivePath));
+	if (!Handle)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Could not open archive %s"), *ArchivePath);
+		return nullptr;
+	}
+
+	const int64 FileSize = Handle->Size();
+	if (FileSize < EndOfCentralDirectorySize)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: %s is not a zip archive"), *ArchivePath);
+		return nullptr;
+	}
+
+	// The end of central directory record is followed by a comment of up to 64 KB
+	const int64 TailSize = FMath::Min<int64>(FileSize, EndOfCentralDirectorySize + 0xFFFF);
+	TArray<uint8> Tail;
+	Tail.SetNumUninitialized(TailSize);
+	if (!ReadAt(*Handle, FileSize - TailSize, Tail.GetData(), TailSize))
+	{
+		return nullptr;
+	}
+
+	int64 EndOfCentralDirectory = INDEX_NONE;
+	for (int64 Pos = TailSize - EndOfCentralDirectorySize; Pos >= 0; Pos--)
+	{
+		if (ReadU32(&Tail[Pos]) == EndOfCentralDirectorySignature)
+		{
+			EndOfCentralDirectory = Pos;
+			break;
+		}
+	}
+
+	if (EndOfCentralDirectory == INDEX_NONE)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: %s is not a zip archive"), *ArchivePath);
+		return nullptr;
+	}
+
+	const uint8* Record = &Tail[EndOfCentralDirectory];
+	const uint16 NumEntries = ReadU16(Record + 10);
+	const uint32 DirectorySize = ReadU32(Record + 12);
+	const uint32 DirectoryOffset = ReadU32(Record + 16);
+
+	if (NumEntries == 0xFFFF || DirectorySize == 0xFFFFFFFF || DirectoryOffset == 0xFFFFFFFF)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: ZIP64 archives are not supported: %s"), *ArchivePath);
+		return nullptr;
+	}
+
+	if ((int64)DirectoryOffset + DirectorySize > FileSize)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Corrupt zip archive: %s"), *ArchivePath);
+		return nullptr;
+	}
+
+	TArray<uint8> Directory;
+	Directory.SetNumUninitialized(DirectorySize);
+	if (!ReadAt(*Handle, DirectoryOffset, Directory.GetData(), DirectorySize))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FZipBundle> Bundle = MakeShared<FZipBundle>();
+	Bundle->ArchivePath = ArchivePath;
+
+	int64 Pos = 0;
+	for (int32 EntryIdx = 0; EntryIdx < NumEntries; EntryIdx++)
+	{
+		if (Pos + CentralDirectoryHeaderSize > Directory.Num() || ReadU32(&Directory[Pos]) != CentralDirectorySignature)
+		{
+			UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Corrupt zip archive: %s"), *ArchivePath);
+			return nullptr;
+		}
+
+		const uint8* Header = &Directory[Pos];
+		const uint16 Flags = ReadU16(Header + 8);
+		const uint16 NameLength = ReadU16(Header + 28);
+		const uint16 ExtraLength = ReadU16(Header + 30);
+		const uint16 CommentLength = ReadU16(Header + 32);
+
+		if (Pos + CentralDirectoryHeaderSize + NameLength > Directory.Num())
+		{
+			UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Corrupt zip archive: %s"), *ArchivePath);
+			return nullptr;
+		}
+
+		FEntry Entry;
+		Entry.Method = ReadU16(Header + 10);
+		Entry.CompressedSize = ReadU32(Header + 20);
+		Entry.UncompressedSize = ReadU32(Header + 24);
+		Entry.LocalHeaderOffset = ReadU32(Header + 42);
+		Entry.Name = NormalizeEntryName(FString(FUTF8ToTCHAR((const ANSICHAR*)Header + CentralDirectoryHeaderSize, NameLength)));
+
+		Pos += CentralDirectoryHeaderSize + NameLength + ExtraLength + CommentLength;
+
+		// Directories have no data
+		if (Entry.Name.IsEmpty() || Entry.Name.EndsWith(TEXT("/")))
+		{
+			continue;
+		}
+
+		if ((Flags & 1) != 0 || (Entry.Method != MethodStored && Entry.Method != MethodDeflated))
+		{
+			UE_LOG(LogRuntimeMeshLoader, Warning, TEXT("Runtime Mesh Loader: Skipping encrypted or unsupported entry %s in %s"), *Entry.Name, *ArchivePath);
+			continue;
+		}
+
+		Bundle->EntryIndices.Add(Entry.Name, Bundle->Entries.Num());
+		Bundle->Entries.Add(MoveTemp(Entry));
+	}
+
+	Bundle->Handle = MoveTemp(Handle);
+	return Bundle;
+}
+
+FZipBundle::~FZipBundle()
+{
+	for (TPair<int32, TFuture<bool>>& Pending : PendingEntries)
+	{
+		Pending.Value.Wait();
+	}
+}
+
+bool FZipBundle::SplitPath(const FString& Path, FString& OutArchivePath, FString& OutEntryName)
+{
+	const FString Normalized = Path.Replace(TEXT("\\"), TEXT("/"));
+	const int32 ExtensionPos = Normalized.Find(TEXT(".zip/"), ESearchCase::IgnoreCase);
+	if (ExtensionPos == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutArchivePath = Normalized.Left(ExtensionPos + 4);
+	OutEntryName = NormalizeEntryName(Normalized.Mid(ExtensionPos + 5));
+	return !OutEntryName.IsEmpty();
+}
+
+bool FZipBundle::FileExists(const FString& Path)
+{
+	FString BundlePath, EntryName;
+	if (!SplitPath(Path, BundlePath, EntryName))
+	{
+		return FPaths::FileExists(Path);
+	}
+
+	TSharedPtr<FZipBundle> Bundle = Open(BundlePath);
+	return Bundle && Bundle->Contains(EntryName);
+}
+
+bool FZipBundle::LoadFileToArray(const FString& Path, TArray<uint8>& OutData)
+{
+	FString BundlePath, EntryName;
+	if (!SplitPath(Path, BundlePath, EntryName))
+	{
+		return FFileHelper::LoadFileToArray(OutData, *Path);
+	}
+
+	TSharedPtr<FZipBundle> Bundle = Open(BundlePath);
+	return Bundle && Bundle->ReadEntry(EntryName, OutData);
+}
+
+bool FZipBundle::Contains(const FString& EntryName) const
+{
+	return FindEntry(EntryName) != nullptr;
+}
+
+TArray<FString> FZipBundle::FindSiblings(const FString& EntryName) const
+{
+	TArray<FString> Siblings;
+	const FEntry* Entry = FindEntry(EntryName);
+	if (!Entry)
+	{
+		return Siblings;
+	}
+
+	Siblings.Add(Entry->Name);
+	const FString Path = FPaths::GetPath(Entry->Name);
+	const FString BaseName = FPaths::GetBaseFilename(Entry->Name);
+	for (const FEntry& Other : Entries)
+	{
+		if (&Other != Entry && FPaths::GetBaseFilename(Other.Name) == BaseName && FPaths::GetPath(Other.Name) == Path)
+		{
+			Siblings.Add(Other.Name);
+		}
+	}
+	return Siblings;
+}
+
+bool FZipBundle::ReadEntry(const FString& EntryName, TArray<uint8>& OutData) const
+{
+	const FEntry* Entry = FindEntry(EntryName);
+	if (!Entry)
+	{
+		return false;
+	}
+
+	if (Entry->bDecompressed)
+	{
+		OutData = Entry->Data;
+		return true;
+	}
+
+	TArray<uint8> Compressed;
+	return ReadCompressed(*Entry, Compressed) && Inflate(*Entry, Compressed, OutData);
+}
+
+bool FZipBundle::ReadEntryPrefix(const FString& EntryName, uint8* Destination, int64 Size) const
+{
+	const FEntry* Entry = FindEntry(EntryName);
+	if (!Entry || Size > Entry->UncompressedSize)
+	{
+		return false;
+	}
+
+	if (Entry->bDecompressed)
+	{
+		FMemory::Memcpy(Destination, Entry->Data.GetData(), Size);
+		return true;
+	}
+
+	int64 DataOffset = 0;
+	if (!GetDataOffset(*Entry, DataOffset))
+	{
+		return false;
+	}
+
+	if (Entry->Method == MethodStored)
+	{
+		return ReadAt(*Handle, DataOffset, Destination, Size);
+	}
+
+	// Raw deflate stream, inflated chunk by chunk until the requested bytes are out
+	z_stream Stream;
+	FMemory::Memzero(Stream);
+	if (inflateInit2(&Stream, -MAX_WBITS) != Z_OK)
+	{
+		return false;
+	}
+
+	uint8 Chunk[4096];
+	int64 CompressedRead = 0;
+	int Result = Z_OK;
+	Stream.next_out = Destination;
+	Stream.avail_out = (uInt)Size;
+	while (Stream.avail_out > 0 && Result == Z_OK && CompressedRead < Entry->CompressedSize)
+	{
+		const int64 ChunkSize = FMath::Min<int64>(sizeof(Chunk), Entry->CompressedSize - CompressedRead);
+		if (!ReadAt(*Handle, DataOffset + CompressedRead, Chunk, ChunkSize))
+		{
+			break;
+		}
+		CompressedRead += ChunkSize;
+
+		Stream.next_in = Chunk;
+		Stream.avail_in = (uInt)ChunkSize;
+		while (Stream.avail_in > 0 && Stream.avail_out > 0 && Result == Z_OK)
+		{
+			Result = inflate(&Stream, Z_NO_FLUSH);
+		}
+	}
+
+	const bool bSuccess = Stream.avail_out == 0;
+	inflateEnd(&Stream);
+	return bSuccess;
+}
+
+TArrayView<const uint8> FZipBundle::Decompress(const FString& EntryName)
+{
+	const int32* EntryIdx = EntryIndices.Find(NormalizeEntryName(EntryName));
+	if (!EntryIdx)
+	{
+		return TArrayView<const uint8>();
+	}
+
+	FEntry& Entry = Entries[*EntryIdx];
+	if (TFuture<bool>* Pending = PendingEntries.Find(*EntryIdx))
+	{
+		// Started by DecompressAsync, the bytes were counted when it was scheduled
+		Entry.bDecompressed = Pending->Get();
+		PendingEntries.Remove(*EntryIdx);
+		if (!Entry.bDecompressed)
+		{
+			DecompressedBytes -= Entry.UncompressedSize;
+			return TArrayView<const uint8>();
+		}
+	}
+	else if (!Entry.bDecompressed)
+	{
+		TArray<uint8> Compressed;
+		Entry.bDecompressed = ReadCompressed(Entry, Compressed) && Inflate(Entry, Compressed, Entry.Data);
+		if (!Entry.bDecompressed)
+		{
+			return TArrayView<const uint8>();
+		}
+		DecompressedBytes += Entry.UncompressedSize;
+	}
+	return TArrayView<const uint8>(Entry.Data);
+}
+
+void FZipBundle::DecompressAsync(const TArray<FString>& EntryNames)
+{
+	for (const FString& EntryName : EntryNames)
+	{
+		const int32* EntryIdx = EntryIndices.Find(NormalizeEntryName(EntryName));
+		if (!EntryIdx || Entries[*EntryIdx].bDecompressed || PendingEntries.Contains(*EntryIdx))
+		{
+			continue;
+		}
+
+		// The file handle is not thread-safe, so the compressed data is read here and only inflated on the worker.
+		// Entries is never resized after Open, the task can hold on to its entry.
+		FEntry& Entry = Entries[*EntryIdx];
+		TArray<uint8> Compressed;
+		if (!ReadCompressed(Entry, Compressed))
+		{
+			continue;
+		}
+
+		DecompressedBytes += Entry.UncompressedSize;
+		PendingEntries.Add(*EntryIdx, Async(EAsyncExecution::ThreadPool, [&Entry, Compressed = MoveTemp(Compressed)]()
+		{
+			return Inflate(Entry, Compressed, Entry.Data);
+		}));
+	}
+}
+
+FString FZipBundle::NormalizeEntryName(const FString& EntryName)
+{
+	FString Name = EntryName.Replace(TEXT("\\"), TEXT("/"));
+	if (!FPaths::CollapseRelativeDirectories(Name))
+	{
+		// Points outside of the archive
+		return FString();
+	}
+
+	while (Name.StartsWith(TEXT("./")))
+	{
+		Name.RightChopInline(2);
+	}
+	Name.RemoveFromStart(TEXT("/"));
+	return Name;
+}
+
+const FZipBundle::FEntry* FZipBundle::FindEntry(const FString& EntryName) const
+{
+	const int32* EntryIdx = EntryIndices.Find(NormalizeEntryName(EntryName));
+	return EntryIdx ? &Entries[*EntryIdx] : nullptr;
+}
+
+bool FZipBundle::GetDataOffset(const FEntry& Entry, int64& OutOffset) const
+{
+	// The local header repeats the name and may have a different extra field than the central directory
+	uint8 Header[LocalHeaderSize];
+	if (!ReadAt(*Handle, Entry.LocalHeaderOffset, Header, LocalHeaderSize) || ReadU32(Header) != LocalHeaderSignature)
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Corrupt entry %s in %s"), *Entry.Name, *ArchivePath);
+		return false;
+	}
+
+	OutOffset = Entry.LocalHeaderOffset + LocalHeaderSize + ReadU16(Header + 26) + ReadU16(Header + 28);
+	return true;
+}
+
+bool FZipBundle::ReadCompressed(const FEntry& Entry, TArray<uint8>& OutCompressed) const
+{
+	int64 DataOffset = 0;
+	if (!GetDataOffset(Entry, DataOffset))
+	{
+		return false;
+	}
+
+	OutCompressed.SetNumUninitialized(Entry.CompressedSize);
+	return Entry.CompressedSize == 0 || ReadAt(*Handle, DataOffset, OutCompressed.GetData(), Entry.CompressedSize);
+}
+
+bool FZipBundle::Inflate(const FEntry& Entry, const TArray<uint8>& Compressed, TArray<uint8>& OutData)
+{
+	if (Entry.Method == MethodStored || Entry.UncompressedSize == 0)
+	{
+		OutData = Compressed;
+		OutData.SetNum(Entry.UncompressedSize);
+		return true;
+	}
+
+	// Zip entries are raw deflate streams without zlib header, a negative bit window selects raw inflate
+	OutData.SetNumUninitialized(Entry.UncompressedSize);
+	if (!FCompression::UncompressMemory(NAME_Zlib, OutData.GetData(), Entry.UncompressedSize, Compressed.GetData(), Entry.CompressedSize, COMPRESS_NoFlags, -DEFAULT_ZLIB_BIT_WINDOW))
+	{
+		UE_LOG(LogRuntimeMeshLoader, Error, TEXT("Runtime Mesh Loader: Failed to inflate %s"), *Entry.Name);
+		OutData.Empty();
+		return false;
+	}
+	return true;
+}
+
+FZipArchiveIOSystem::FZipArchiveIOSystem(TSharedPtr<FZipBundle> InBundle, bool bMemoryMapped)
+	: Bundle(InBundle)
+	, Fallback(new FPlatformFileIOSystem(bMemoryMapped))
+{
+}
+
+FZipArchiveIOSystem::~FZipArchiveIOSystem()
+{
+	delete Fallback;
+}
+
+bool FZipArchiveIOSystem::Exists(const char* pFile) const
+{
+	return !ToEntryName(pFile).IsEmpty() || Fallback->Exists(pFile);
+}
+
+char FZipArchiveIOSystem::getOsSeparator() const
+{
+	return '/';
+}
+
+Assimp::IOStream* FZipArchiveIOSystem::Open(const char* pFile, const char* pMode)
+{
+	const FString EntryName = ToEntryName(pFile);
+	if (EntryName.IsEmpty())
+	{
+		return Fallback->Open(pFile, pMode);
+	}
+
+	if (pMode && (FCStringAnsi::Strchr(pMode, 'w') || FCStringAnsi::Strchr(pMode, 'a')))
+	{
+		return nullptr;
+	}
+
+	// Entries started with DecompressAsync are waited for, any other entry is inflated the first time Assimp opens it.
+	// Streams read the inflated data in place, the bundle outlives the importer that owns this IO system.
+	TArrayView<const uint8> Data = Bundle->Decompress(EntryName);
+	if (!Data.GetData())
+	{
+		return nullptr;
+	}
+	return new Assimp::MemoryIOStream(Data.GetData(), Data.Num(), false);
+}
+
+void FZipArchiveIOSystem::Close(Assimp::IOStream* pFile)
+{
+	delete pFile;
+}
+
+FString FZipArchiveIOSystem::ToEntryName(const char* pFile) const
+{
+	if (!pFile)
+	{
+		return FString();
+	}
+
+	FString Path = FString(UTF8_TO_TCHAR(pFile)).Replace(TEXT("\\"), TEXT("/"));
+	const FString Prefix = Bundle->GetArchivePath() + TEXT("/");
+
+	FString EntryName;
+	if (Path.StartsWith(Prefix, ESearchCase::IgnoreCase))
+	{
+		EntryName = Path.Mid(Prefix.Len());
+	}
+	else if (FPaths::IsRelative(Path))
+	{
+		EntryName = Path;
+	}
+
+	return Bundle->Contains(EntryName) ? EntryName : FString();
+}
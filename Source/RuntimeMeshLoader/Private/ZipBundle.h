@@ -0,0 +1,117 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+
+#include <assimp/IOSystem.hpp>
+
+class IFileHandle;
+class FPlatformFileIOSystem;
+
+/**
+ * Read-only view of a .zip model bundle. Only the central directory is read when the bundle is opened,
+ * entry data is read and inflated on demand, either as a copy (ReadEntry) or cached in the bundle (Decompress).
+ * Entries a load is known to need can be inflated on worker threads ahead of time (DecompressAsync).
+ * Supports stored and deflated entries, encrypted and ZIP64 archives are rejected.
+ *
+ * Paths of the form "Dir/bundle.zip/model.fbx" address the entry "model.fbx" of "Dir/bundle.zip".
+ */
+class FZipBundle
+{
+public:
+	/** Opens an archive and reads its central directory, returns null if it is not a supported zip file */
+	static TSharedPtr<FZipBundle> Open(const FString& ArchivePath);
+
+	/** Waits for the entries still inflating on worker threads */
+	~FZipBundle();
+
+	/** Splits a bundle path into the archive path and the entry name, returns false for plain paths */
+	static bool SplitPath(const FString& Path, FString& OutArchivePath, FString& OutEntryName);
+
+	/** FPaths::FileExists / FFileHelper::LoadFileToArray that also accept bundle paths */
+	static bool FileExists(const FString& Path);
+	static bool LoadFileToArray(const FString& Path, TArray<uint8>& OutData);
+
+	bool Contains(const FString& EntryName) const;
+
+	/** Entries in the same folder as EntryName with the same base name (e.g. model.obj and model.mtl), EntryName first */
+	TArray<FString> FindSiblings(const FString& EntryName) const;
+
+	/** Reads and inflates a single entry */
+	bool ReadEntry(const FString& EntryName, TArray<uint8>& OutData) const;
+
+	/** Reads the first Size bytes of an entry, only the compressed data needed for them is read and inflated */
+	bool ReadEntryPrefix(const FString& EntryName, uint8* Destination, int64 Size) const;
+
+	/**
+	 * Inflates an entry on first use and keeps it until the bundle is destroyed, so repeated opens are served from memory.
+	 * Returns an empty view if the entry does not exist or failed to inflate. Not thread-safe.
+	 */
+	TArrayView<const uint8> Decompress(const FString& EntryName);
+
+	/**
+	 * Reads the compressed data of the given entries and inflates them in parallel on the thread pool. Decompress
+	 * waits for an entry that is still inflating instead of inflating it again. Not thread-safe.
+	 */
+	void DecompressAsync(const TArray<FString>& EntryNames);
+
+	/** Memory held by the entries inflated through Decompress and DecompressAsync */
+	int64 GetDecompressedBytes() const { return DecompressedBytes; }
+
+	const FString& GetArchivePath() const { return ArchivePath; }
+
+private:
+	struct FEntry
+	{
+		FString Name;
+		int64 LocalHeaderOffset = 0;
+		int64 CompressedSize = 0;
+		int64 UncompressedSize = 0;
+		uint16 Method = 0;
+		bool bDecompressed = false;
+		TArray<uint8> Data;
+	};
+
+	static FString NormalizeEntryName(const FString& EntryName);
+
+	const FEntry* FindEntry(const FString& EntryName) const;
+	bool GetDataOffset(const FEntry& Entry, int64& OutOffset) const;
+	bool ReadCompressed(const FEntry& Entry, TArray<uint8>& OutCompressed) const;
+	static bool Inflate(const FEntry& Entry, const TArray<uint8>& Compressed, TArray<uint8>& OutData);
+
+	FString ArchivePath;
+	TUniquePtr<IFileHandle> Handle;
+	TArray<FEntry> Entries;
+
+	/** Normalized entry name to index into Entries, FString keys compare case-insensitively */
+	TMap<FString, int32> EntryIndices;
+
+	/** Entries inflating on the thread pool, by index into Entries. The tasks write to Data of their entry only */
+	TMap<int32, TFuture<bool>> PendingEntries;
+
+	int64 DecompressedBytes = 0;
+};
+
+/**
+ * Assimp IO system that serves the files of a zip bundle, so the model and its siblings
+ * (materials, textures, buffers) are read from the archive without extracting it.
+ * Paths outside of the archive are forwarded to a FPlatformFileIOSystem.
+ */
+class FZipArchiveIOSystem : public Assimp::IOSystem
+{
+public:
+	FZipArchiveIOSystem(TSharedPtr<FZipBundle> InBundle, bool bMemoryMapped);
+	virtual ~FZipArchiveIOSystem();
+
+	virtual bool Exists(const char* pFile) const override;
+	virtual char getOsSeparator() const override;
+	virtual Assimp::IOStream* Open(const char* pFile, const char* pMode = "rb") override;
+	virtual void Close(Assimp::IOStream* pFile) override;
+
+private:
+	/** Returns the entry name for a path inside the archive, or an empty string */
+	FString ToEntryName(const char* pFile) const;
+
+	TSharedPtr<FZipBundle> Bundle;
+	FPlatformFileIOSystem* Fallback;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MeshLoader.h"
+#include "PackedNormal.h"
+#include "Math/Vector2DHalf.h"
+
+/**
+ * Compact, render-ready copy of FMeshData for models that stay resident: float positions, packed normals and tangents,
+ * float or half UVs and 16-bit indices where the vertex count allows. Takes about 24-28 bytes per vertex instead of
+ * roughly 100. LODs are not carried over.
+ */
+struct RUNTIMEMESHLOADER_API FCompactMeshData
+{
+	TArray<FVector3f> Positions;
+	TArray<FPackedNormal> Normals;
+	// W holds the sign of the binormal (-1 if FProcMeshTangent::bFlipTangentY was set)
+	TArray<FPackedNormal> Tangents;
+	// Only one of the UV arrays is filled
+	TArray<FVector2f> UVs;
+	TArray<FVector2DHalf> HalfUVs;
+	// Only one of the index arrays is filled
+	TArray<uint16> Indices16;
+	TArray<uint32> Indices32;
+
+	int32 NumVertices() const { return Positions.Num(); }
+	int32 NumIndices() const { return Indices16.Num() > 0 ? Indices16.Num() : Indices32.Num(); }
+	uint32 GetIndex(int32 Index) const { return Indices16.Num() > 0 ? (uint32)Indices16[Index] : Indices32[Index]; }
+
+	SIZE_T GetAllocatedSize() const;
+
+	/**
+	 * Packs a mesh, attributes that are empty in Mesh stay empty
+	 *
+	 * @param bHalfUVs - Store UVs as 16-bit floats, precise to about 1/2048 which is enough for textures up to 2K
+	 */
+	static FCompactMeshData FromMeshData(const FMeshData& Mesh, bool bHalfUVs = false);
+
+	/** Unpacks into the arrays CreateMeshSection expects */
+	void ToMeshData(FMeshData& OutMesh) const;
+
+	/** Unpacks straight into a section for SetProcMeshSection, absent attributes keep the FProcMeshVertex defaults */
+	void ToProcMeshSection(FProcMeshSection& OutSection) const;
+};
+
+struct RUNTIMEMESHLOADER_API FCompactNodeData
+{
+	FTransform RelativeTransform;
+	int32 NodeParentIndex = -1;
+	TArray<FCompactMeshData> Meshes;
+};
+
+/** Compact counterpart of FFinalReturnData */
+struct RUNTIMEMESHLOADER_API FCompactReturnData
+{
+	bool Success = false;
+	TArray<FCompactNodeData> Nodes;
+	// Memory of the load, ConvertedBytes refers to the unpacked data
+	FMeshLoadMemoryReport Memory;
+
+	SIZE_T GetAllocatedSize() const;
+
+	/** Packs ReturnData mesh by mesh, each mesh of ReturnData is freed as soon as it is packed */
+	static FCompactReturnData FromReturnData(FFinalReturnData&& ReturnData, bool bHalfUVs = false);
+};
@@ -6,8 +6,13 @@
 
 #include "ProceduralMeshComponent.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include <atomic>
 #include "MeshLoader.generated.h"
 
+struct FCompactReturnData;
+struct FSceneBufferData;
+class URuntimeMeshHandle;
+
 UENUM(BlueprintType)
 enum class EPathType : uint8
 {
@@ -15,6 +20,54 @@ enum class EPathType : uint8
 	Relative
 };
 
+// How Assimp reads the mesh file and the files it references
+UENUM(BlueprintType)
+enum class EMeshFileIOBackend : uint8
+{
+	// Buffered reads through IPlatformFile, works for loose files and pak content
+	PlatformFile,
+	// Reads from a memory-mapped view of the file, best for very large files. Falls back to PlatformFile if the file cannot be mapped (e.g. pak content)
+	MemoryMapped,
+	// Assimp's own fopen based IO, for comparison
+	AssimpDefault
+};
+
+UENUM(BlueprintType)
+enum class EMeshLoadStage : uint8
+{
+	Parse,
+	PostProcess,
+	Conversion,
+	TextureDecode
+};
+
+// Vertex attributes besides positions and indices, which are always imported
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EMeshAttributes : uint8
+{
+	None = 0 UMETA(Hidden),
+	Normals = 1 << 0,
+	UVs = 1 << 1,
+	// Tangents are computed from normals and UVs, requesting them imports both
+	Tangents = 1 << 2,
+	All = Normals | UVs | Tangents UMETA(Hidden)
+};
+ENUM_CLASS_FLAGS(EMeshAttributes);
+
+/** Cancels a running load from any thread, the load stops at its next checkpoint and fails */
+class FMeshLoadCancellationToken
+{
+public:
+	void Cancel() { bCancelled.store(true, std::memory_order_relaxed); }
+	bool IsCancelled() const { return bCancelled.load(std::memory_order_relaxed); }
+
+private:
+	std::atomic<bool> bCancelled{ false };
+};
+
+/** Reports the progress (0-1) of a load stage, called on the thread that runs the load */
+DECLARE_DELEGATE_TwoParams(FOnMeshLoadProgress, EMeshLoadStage /*Stage*/, float /*Progress*/);
+
 // Get the appropriate vector types based on UE version
 #if WITH_UE_5_0
     // UE 5.0+ uses double precision vectors
@@ -26,6 +79,33 @@ enum class EPathType : uint8
     #define FVector2DCompat FVector2D
 #endif
 
+USTRUCT(BlueprintType)
+struct FMeshLODData
+{
+    GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FinalReturnData")
+	TArray<FVector> Vertices;
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FinalReturnData")
+	TArray<int32> Triangles;
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FinalReturnData")
+	TArray<FVector> Normals;
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FinalReturnData")
+	TArray<FVector2D> UVs;
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FinalReturnData")
+	TArray<FProcMeshTangent> Tangents;
+
+	// Screen size below which this LOD is displayed
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FinalReturnData")
+	float ScreenSize;
+
+    FMeshLODData() : ScreenSize(0.0f) { }
+};
+
 USTRUCT(BlueprintType)
 struct FMeshData
 {
@@ -45,9 +125,20 @@ struct FMeshData
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FinalReturnData")
 	TArray<FProcMeshTangent> Tangents;
+
+	// Simplified LOD1..LODn of this mesh, only filled if LOD generation was requested
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FinalReturnData")
+	TArray<FMeshLODData> LODs;
+
+	// Attributes the mesh has (EMeshAttributes). The arrays of absent attributes are empty, not default-filled,
+	// CreateMeshSection uses constant defaults for them
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FinalReturnData", meta = (Bitmask, BitmaskEnum = "/Script/RuntimeMeshLoader.EMeshAttributes"))
+	int32 Attributes;
+
+	bool HasAttribute(EMeshAttributes Attribute) const { return EnumHasAnyFlags((EMeshAttributes)Attributes, Attribute); }
     
     // Default constructor to initialize arrays
-    FMeshData() { }
+    FMeshData() : Attributes(0) { }
 };
 
 USTRUCT(BlueprintType)
@@ -68,6 +159,45 @@ struct FNodeData
     FNodeData() : NodeParentIndex(-1) { }
 };
 
+// Memory used by one load, in bytes. Assimp sizes come from aiMemoryInfo, the texture size is estimated from the PNG headers.
+USTRUCT(BlueprintType)
+struct FMeshLoadMemoryReport
+{
+    GENERATED_USTRUCT_BODY()
+
+	// Size of the mesh file or buffer, Assimp keeps it in memory while parsing. For bundles the inflated entries, held until the load ends
+	UPROPERTY(BlueprintReadOnly, Category = "MemoryReport")
+	int64 SourceBytes = 0;
+
+	// Assimp scene right after parsing
+	UPROPERTY(BlueprintReadOnly, Category = "MemoryReport")
+	int64 ParsedSceneBytes = 0;
+
+	// Assimp scene after post-processing, held until conversion is done
+	UPROPERTY(BlueprintReadOnly, Category = "MemoryReport")
+	int64 SceneBytes = 0;
+
+	// Parts of SceneBytes used by meshes and embedded textures
+	UPROPERTY(BlueprintReadOnly, Category = "MemoryReport")
+	int64 SceneMeshBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "MemoryReport")
+	int64 SceneTextureBytes = 0;
+
+	// Allocated size of the returned mesh data, LODs included
+	UPROPERTY(BlueprintReadOnly, Category = "MemoryReport")
+	int64 ConvertedBytes = 0;
+
+	// Size of the <Name>_T.png / <Name>_N.png textures once decoded (BGRA8)
+	UPROPERTY(BlueprintReadOnly, Category = "MemoryReport")
+	int64 TextureBytes = 0;
+
+	// Estimate of the most memory the load held at once: source and parsed scene while parsing, or scene and
+	// converted data while converting, plus the prefetched textures
+	UPROPERTY(BlueprintReadOnly, Category = "MemoryReport")
+	int64 PeakTransientBytes = 0;
+};
+
 USTRUCT(BlueprintType)
 struct FFinalReturnData
 {
@@ -78,11 +208,183 @@ struct FFinalReturnData
     
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FinalReturnData")
 	TArray<FNodeData> Nodes;
+
+	UPROPERTY(BlueprintReadOnly, Category = "FinalReturnData")
+	FMeshLoadMemoryReport Memory;
     
     // Default constructor with initialization
     FFinalReturnData() : Success(false) { }
 };
 
+USTRUCT(BlueprintType)
+struct FMeshImportOptions
+{
+    GENERATED_USTRUCT_BODY()
+
+	// Generate simplified LODs for every mesh (quadric error edge collapse, runs on worker threads)
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ImportOptions|LOD")
+	bool bGenerateLODs;
+
+	// Triangle ratio of each generated LOD relative to the source mesh, LOD1..LOD3 (at most 3 entries are used)
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ImportOptions|LOD")
+	TArray<float> LODReductionRatios;
+
+	// Screen size below which each generated LOD is displayed, one entry per reduction ratio
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ImportOptions|LOD")
+	TArray<float> LODScreenSizes;
+
+	// Meshes with fewer triangles than this do not get LODs
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ImportOptions|LOD")
+	int32 LODMinTriangleCount;
+
+	// How the file is read from disk
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ImportOptions|IO")
+	EMeshFileIOBackend IOBackend;
+
+	// Decode the <Name>_T.png / <Name>_N.png textures on worker threads while the mesh is parsed,
+	// LoadTexture2DFromFile uses the results instead of loading the files again. Only enable it if the textures are
+	// loaded afterwards, the helper functions that create materials do so themselves
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ImportOptions|Textures")
+	bool bPrefetchTextures;
+
+	// Vertex attributes to import, unrequested attributes are stripped before post-processing and their FMeshData arrays stay empty.
+	// Position-only loads (collision proxies, occluders, thumbnails) also skip normal and tangent generation.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ImportOptions|Attributes", meta = (Bitmask, BitmaskEnum = "/Script/RuntimeMeshLoader.EMeshAttributes"))
+	int32 Attributes;
+
+	// Merge vertices whose position, normal and UV are within the epsilons below. Unwelded exports (STL, many OBJ and FBX files)
+	// have three vertices per triangle, welding brings that down to about one
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ImportOptions|Welding")
+	bool bWeldVertices;
+
+	// Maximum distance between welded positions, in file units
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ImportOptions|Welding", meta = (ClampMin = "0"))
+	float WeldPositionEpsilon;
+
+	// Maximum distance between welded unit normals, the normals of welded vertices are averaged.
+	// 2 welds regardless of normals, e.g. to smooth faceted STL files
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ImportOptions|Welding", meta = (ClampMin = "0", ClampMax = "2"))
+	float WeldNormalEpsilon;
+
+	// Maximum distance between welded UVs
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ImportOptions|Welding", meta = (ClampMin = "0"))
+	float WeldUVEpsilon;
+
+	// Split meshes above the limits below into several meshes, each gets its own section. Smaller sections are culled
+	// individually, and meshes of at most 65536 vertices can use 16-bit indices (FCompactMeshData, FSceneBufferData)
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ImportOptions|Splitting")
+	bool bSplitLargeMeshes;
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ImportOptions|Splitting", meta = (ClampMin = "3"))
+	int32 SplitVertexLimit;
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ImportOptions|Splitting", meta = (ClampMin = "1"))
+	int32 SplitTriangleLimit;
+
+	// Only import the subtrees of nodes whose name or path matches one of these entries, e.g. "Robot2" or "Line3/Robot2".
+	// A path lists node names below the root node separated by '/'. Meshes outside the selected subtrees are skipped
+	// and their ancestors are kept, without meshes, so transforms stay intact. Empty imports the whole scene.
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "ImportOptions|Nodes")
+	TArray<FString> NodeFilter;
+
+	// C++ only: cancels the load, parsing, post-processing and conversion stop early and their memory is freed
+	TSharedPtr<FMeshLoadCancellationToken> CancellationToken;
+
+	// C++ only: progress of the parse, post-processing and conversion stages
+	FOnMeshLoadProgress OnProgress;
+
+	bool IsCancelled() const { return CancellationToken.IsValid() && CancellationToken->IsCancelled(); }
+	void ReportProgress(EMeshLoadStage Stage, float Progress) const { OnProgress.ExecuteIfBound(Stage, Progress); }
+
+	// Requested attributes, tangents imply normals and UVs
+	EMeshAttributes GetAttributes() const
+	{
+		EMeshAttributes Result = (EMeshAttributes)Attributes & EMeshAttributes::All;
+		return EnumHasAnyFlags(Result, EMeshAttributes::Tangents) ? Result | EMeshAttributes::All : Result;
+	}
+
+    FMeshImportOptions()
+        : bGenerateLODs(false)
+        , LODMinTriangleCount(1000)
+        , IOBackend(EMeshFileIOBackend::PlatformFile)
+        , bPrefetchTextures(false)
+        , Attributes((int32)EMeshAttributes::All)
+        , bWeldVertices(false)
+        , WeldPositionEpsilon(0.001f)
+        , WeldNormalEpsilon(0.01f)
+        , WeldUVEpsilon(0.0001f)
+        , bSplitLargeMeshes(false)
+        , SplitVertexLimit(65536)
+        , SplitTriangleLimit(1000000)
+    {
+        LODReductionRatios = { 0.5f, 0.25f, 0.1f };
+        LODScreenSizes = { 0.5f, 0.25f, 0.1f };
+    }
+};
+
+USTRUCT(BlueprintType)
+struct FMeshFileInfo
+{
+    GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "MeshFileInfo")
+	bool Success = false;
+
+	// Counts were read from the file header (binary STL, PLY), only vertex, triangle and mesh counts are filled and
+	// the PLY triangle count assumes triangular faces
+	UPROPERTY(BlueprintReadOnly, Category = "MeshFileInfo")
+	bool bFromHeaderScan = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "MeshFileInfo")
+	int64 FileSize = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "MeshFileInfo")
+	int64 NumVertices = 0;
+
+	// Triangles after triangulation, polygons count as (corners - 2) triangles
+	UPROPERTY(BlueprintReadOnly, Category = "MeshFileInfo")
+	int64 NumTriangles = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "MeshFileInfo")
+	int32 NumMeshes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "MeshFileInfo")
+	int32 NumMaterials = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "MeshFileInfo")
+	int32 NumNodes = 0;
+
+	// Texture paths referenced by the materials, embedded textures are listed as "*<index>"
+	UPROPERTY(BlueprintReadOnly, Category = "MeshFileInfo")
+	TArray<FString> TextureReferences;
+
+	// Bounds in the same space as LoadMeshFromFile results, invalid after a header scan
+	UPROPERTY(BlueprintReadOnly, Category = "MeshFileInfo")
+	FBox Bounds = FBox(ForceInit);
+};
+
+USTRUCT(BlueprintType)
+struct FMeshIOBenchmarkResult
+{
+    GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "IOBenchmark")
+	bool Success = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "IOBenchmark")
+	float FileSizeMB = 0.0f;
+
+	// Average parse time in milliseconds per backend, without post-processing
+	UPROPERTY(BlueprintReadOnly, Category = "IOBenchmark")
+	float AssimpDefaultMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "IOBenchmark")
+	float PlatformFileMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "IOBenchmark")
+	float MemoryMappedMs = 0.0f;
+};
+
 /**
  * 
  */
@@ -95,12 +397,57 @@ public:
 	UFUNCTION(BlueprintCallable,Category="RuntimeMeshLoader")
 	static FFinalReturnData LoadMeshFromFile(FString FilePath, EPathType type = EPathType::Absolute);
 
+	UFUNCTION(BlueprintCallable,Category="RuntimeMeshLoader")
+	static FFinalReturnData LoadMeshFromFileWithOptions(FString FilePath, EPathType type, const FMeshImportOptions& Options);
+
+	// Loads a mesh into a handle that Blueprint passes by reference, so the mesh arrays are not copied on every pin access.
+	// Returns null if the load failed.
+	UFUNCTION(BlueprintCallable,Category="RuntimeMeshLoader")
+	static URuntimeMeshHandle* LoadMeshHandleFromFile(FString FilePath, EPathType type, const FMeshImportOptions& Options);
+
+	// Loads a mesh from a buffer in memory (pak, download cache...), FormatHint is the file extension, e.g. "fbx"
+	UFUNCTION(BlueprintCallable,Category="RuntimeMeshLoader")
+	static FFinalReturnData LoadMeshFromMemory(const TArray<uint8>& Buffer, FString FormatHint);
+
+	UFUNCTION(BlueprintCallable,Category="RuntimeMeshLoader")
+	static FFinalReturnData LoadMeshFromMemoryWithOptions(const TArray<uint8>& Buffer, FString FormatHint, const FMeshImportOptions& Options);
+
+	// Non-owning version, the buffer is parsed in place and only has to stay alive for the duration of the call
+	static FFinalReturnData LoadMeshFromMemory(TArrayView<const uint8> Buffer, const FString& FormatHint, const FMeshImportOptions& Options = FMeshImportOptions());
+
+	// Loads a mesh into the compact vertex format (float positions, packed normals and tangents, 16-bit indices where possible),
+	// for models that stay resident. Create sections from it with URuntimeMeshLoaderHelper::CreateMeshSectionFromCompact.
+	static FCompactReturnData LoadCompactMeshFromFile(const FString& FilePath, EPathType type, const FMeshImportOptions& Options, bool bHalfUVs = false);
+
+	// Converts every non-empty mesh straight into an FProcMeshSection, in the order LoadMeshWithTextures creates sections.
+	// Skips the FMeshData arrays and their conversion pass, install the sections with SetProcMeshSection or
+	// URuntimeMeshLoaderHelper::LoadMeshSectionsWithTextures. Welding and LOD generation are not applied.
+	static bool LoadMeshSectionsFromFile(const FString& FilePath, EPathType type, const FMeshImportOptions& Options, TArray<FProcMeshSection>& OutSections, FMeshLoadMemoryReport* OutMemory = nullptr);
+
+	// Loads a mesh into scene-wide vertex, attribute and index buffers with per-mesh ranges, for bulk serialization and GPU uploads.
+	// Create sections from it with URuntimeMeshLoaderHelper::CreateMeshSectionFromSceneBuffers.
+	static FSceneBufferData LoadSceneBuffersFromFile(const FString& FilePath, EPathType type, const FMeshImportOptions& Options);
+
+	// Reads scene statistics without post-processing or conversion, so oversized files can be rejected before loading.
+	// Binary STL and PLY files are only header-scanned unless bComputeBounds is set.
+	UFUNCTION(BlueprintCallable,Category="RuntimeMeshLoader")
+	static FMeshFileInfo ProbeMeshFile(FString FilePath, EPathType type = EPathType::Absolute, bool bComputeBounds = false);
+
+	// Parses a file with every IO backend and reports the average time of each, results are logged as well
+	UFUNCTION(BlueprintCallable,Category="RuntimeMeshLoader")
+	static FMeshIOBenchmarkResult BenchmarkFileIO(FString FilePath, EPathType type = EPathType::Absolute, int32 Iterations = 3);
+
+	// Estimated transient memory of all loads currently running, for admission control before starting another one
+	UFUNCTION(BlueprintPure,Category="RuntimeMeshLoader")
+	static int64 GetInFlightImportMemory();
+
 	UFUNCTION(BlueprintCallable,Category="RuntimeMeshLoader")
 	static bool DirectoryExists(FString DirectoryPath);
 
 	UFUNCTION(BlueprintCallable,Category="RuntimeMeshLoader")
 	static bool CreateDirectory(FString DirectoryPath);
 
+	/** Lists all folders below DirectoryPath, blocking. For large libraries use URuntimeMeshAssetIndexSubsystem instead */
 	UFUNCTION(BlueprintCallable,Category="RuntimeMeshLoader")
 	static TArray<FString> ListFolders(FString DirectoryPath);
 
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Containers/Ticker.h"
+#include <atomic>
+#include "RuntimeMeshAssetIndexSubsystem.generated.h"
+
+struct FFileChangeData;
+
+USTRUCT(BlueprintType)
+struct FMeshAssetEntry
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "AssetIndex")
+	FString Path;
+
+	// <Name>_T.png next to the model, empty if there is none
+	UPROPERTY(BlueprintReadOnly, Category = "AssetIndex")
+	FString TexturePath;
+
+	// <Name>_N.png next to the model, empty if there is none
+	UPROPERTY(BlueprintReadOnly, Category = "AssetIndex")
+	FString NormalPath;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AssetIndex")
+	int64 Size = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AssetIndex")
+	FDateTime ModifiedTime;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAssetIndexUpdated);
+
+/**
+ * Index of the model files below a library directory, as a non-blocking replacement for UMeshLoader::ListFolders.
+ * The directory tree is scanned on a background thread, the result is persisted as a manifest in the Saved directory.
+ * On the next start the manifest is used right away, while a background scan checks it against the directory and
+ * replaces the index if anything changed in the meantime. Where the DirectoryWatcher module is available (editor and
+ * development builds) the index also follows file changes incrementally while the application runs.
+ */
+UCLASS()
+class RUNTIMEMESHLOADER_API URuntimeMeshAssetIndexSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static URuntimeMeshAssetIndexSubsystem* Get();
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Indexes RootDirectory in the background, OnIndexUpdated fires once the index is ready
+	 *
+	 * @param RootDirectory - Library directory to index
+	 * @param bForceRescan - Ignore the manifest of an earlier scan and wait for a fresh scan
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|AssetIndex")
+	void StartScan(FString RootDirectory, bool bForceRescan = false);
+
+	UFUNCTION(BlueprintPure, Category = "RuntimeMeshLoader|AssetIndex")
+	bool IsScanning() const { return bScanning; }
+
+	UFUNCTION(BlueprintPure, Category = "RuntimeMeshLoader|AssetIndex")
+	int32 GetNumFolders() const { return Folders.Num(); }
+
+	/**
+	 * Returns a page of the indexed models, sorted by path
+	 *
+	 * @param Offset - Index of the first model of the page
+	 * @param Count - Maximum number of models to return
+	 * @param Folder - Only return models below this folder, empty for all models
+	 * @param TotalCount - Number of models matching Folder
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|AssetIndex")
+	TArray<FMeshAssetEntry> GetModels(int32 Offset, int32 Count, FString Folder, int32& TotalCount) const;
+
+	/** Returns a page of the indexed folders, sorted by path */
+	UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|AssetIndex")
+	TArray<FString> GetFolders(int32 Offset, int32 Count) const;
+
+	/** Fires on the game thread whenever the index changed */
+	UPROPERTY(BlueprintAssignable, Category = "RuntimeMeshLoader|AssetIndex")
+	FOnAssetIndexUpdated OnIndexUpdated;
+
+private:
+	void ApplySnapshot(const FString& ScannedRoot, TArray<FString>&& InFolders, TArray<FMeshAssetEntry>&& InModels, bool bSaveManifest);
+	void SaveManifest() const;
+	FString GetManifestPath() const;
+
+	void StartWatching();
+	void StopWatching();
+	void OnDirectoryChanged(const TArray<FFileChangeData>& Changes);
+	bool TickDirectoryWatcher(float DeltaTime);
+
+	void ScanAddedFolder(const FString& FolderPath);
+	void MergeFolder(const FString& FolderPath, TArray<FString>&& SubFolders, TArray<FMeshAssetEntry>&& SubModels);
+
+	void UpsertModel(const FString& ModelPath);
+	void RemoveModel(const FString& ModelPath);
+	void RemoveFolder(const FString& FolderPath);
+
+	FString RootDirectory;
+	TArray<FString> Folders;
+	TArray<FMeshAssetEntry> Models;
+
+	bool bScanning = false;
+	int32 ScanGeneration = 0;
+	TSharedPtr<std::atomic<bool>> ScanCancelled;
+
+	FDelegateHandle WatcherHandle;
+	FTSTicker::FDelegateHandle WatcherTickHandle;
+};
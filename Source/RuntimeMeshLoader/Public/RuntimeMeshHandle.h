@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "MeshLoader.h"
+#include "ProceduralMeshComponent.h"
+#include "RuntimeMeshHandle.generated.h"
+
+/**
+ * Reference to loaded mesh data for Blueprint. FFinalReturnData is a struct, so Blueprint copies all of its arrays
+ * on every pin read, break or array access. A handle is passed by reference instead and its accessors only touch the
+ * mesh they are asked about. The data is immutable once loaded and can be shared between handles and threads.
+ */
+UCLASS(BlueprintType)
+class RUNTIMEMESHLOADER_API URuntimeMeshHandle : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Takes ownership of ReturnData, returns null if the load failed */
+	static URuntimeMeshHandle* Create(FFinalReturnData&& ReturnData);
+
+	/** Shared immutable data, for C++ code that works on the whole result */
+	const TSharedPtr<const FFinalReturnData>& GetData() const { return Data; }
+
+	UFUNCTION(BlueprintPure, Category = "RuntimeMeshLoader|Handle")
+	int32 GetNumNodes() const;
+
+	/** Number of meshes over all nodes, meshes are indexed in node order */
+	UFUNCTION(BlueprintPure, Category = "RuntimeMeshLoader|Handle")
+	int32 GetNumMeshes() const { return MeshIndices.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "RuntimeMeshLoader|Handle")
+	int32 GetMeshNodeIndex(int32 MeshIndex) const;
+
+	UFUNCTION(BlueprintPure, Category = "RuntimeMeshLoader|Handle")
+	int32 GetMeshVertexCount(int32 MeshIndex) const;
+
+	UFUNCTION(BlueprintPure, Category = "RuntimeMeshLoader|Handle")
+	int32 GetMeshTriangleCount(int32 MeshIndex) const;
+
+	UFUNCTION(BlueprintPure, Category = "RuntimeMeshLoader|Handle")
+	FTransform GetNodeTransform(int32 NodeIndex, int32& ParentIndex) const;
+
+	UFUNCTION(BlueprintPure, Category = "RuntimeMeshLoader|Handle")
+	FMeshLoadMemoryReport GetMemoryReport() const;
+
+	/** Copies the arrays of a single mesh, returns false if MeshIndex is out of range */
+	UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|Handle")
+	bool GetMeshSection(int32 MeshIndex, FMeshData& MeshData) const;
+
+	/** Creates one section from a mesh without copying it through Blueprint */
+	UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|Handle")
+	bool CreateMeshSection(UProceduralMeshComponent* ProceduralMeshComponent, int32 SectionIndex, int32 MeshIndex, bool bCreateCollision = true) const;
+
+	/**
+	 * Creates a section for every non-empty mesh, numbered from 0 like LoadMeshWithTextures does
+	 *
+	 * @param Material - Material for all sections, can be null
+	 * @param bClearMesh - Remove the existing sections first
+	 * @return Number of created sections
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|Handle")
+	int32 CreateMeshSections(UProceduralMeshComponent* ProceduralMeshComponent, UMaterialInterface* Material = nullptr, bool bClearMesh = true, bool bCreateCollision = true) const;
+
+private:
+	const FMeshData* GetMesh(int32 MeshIndex) const;
+
+	TSharedPtr<const FFinalReturnData> Data;
+
+	// Node and mesh index of every mesh in node order
+	TArray<FIntPoint> MeshIndices;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MeshLoader.h"
+#include "ProceduralMeshComponent.h"
+#include "RuntimeMeshLODComponent.generated.h"
+
+class UMaterialInterface;
+
+/**
+ * Procedural mesh component that switches between the LODs generated at import time
+ * (see FMeshImportOptions::bGenerateLODs) based on the screen size of its bounds.
+ * Every LOD of every mesh is a section of its own, switching LODs only toggles section visibility.
+ */
+UCLASS(ClassGroup = (Rendering), meta = (BlueprintSpawnableComponent))
+class RUNTIMEMESHLOADER_API URuntimeMeshLODComponent : public UProceduralMeshComponent
+{
+	GENERATED_BODY()
+
+public:
+	URuntimeMeshLODComponent(const FObjectInitializer& ObjectInitializer);
+
+	/**
+	 * Replaces all sections with the meshes and LODs of MeshData
+	 *
+	 * @param MeshData - Loaded mesh data, LODs are taken from FMeshData::LODs
+	 * @param Material - Material applied to every section, may be null
+	 * @param bCreateCollision - Whether collision is created, only LOD0 sections get collision
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|LOD")
+	void SetMeshData(const FFinalReturnData& MeshData, UMaterialInterface* Material, bool bCreateCollision = true);
+
+	/** Forces a LOD for all meshes, pass -1 to go back to automatic selection */
+	UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|LOD")
+	void SetForcedLOD(int32 LODIndex);
+
+	/** Highest LOD currently displayed by any of the meshes */
+	UFUNCTION(BlueprintPure, Category = "RuntimeMeshLoader|LOD")
+	int32 GetCurrentLOD() const { return CurrentLOD; }
+
+	/** Screen size of the component bounds as seen from the first local player's camera */
+	UFUNCTION(BlueprintPure, Category = "RuntimeMeshLoader|LOD")
+	float GetScreenSize() const;
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+private:
+	struct FLODSections
+	{
+		/** Section index of LOD0..LODn */
+		TArray<int32> SectionIndices;
+
+		/** Screen size threshold of LOD1..LODn */
+		TArray<float> ScreenSizes;
+
+		int32 VisibleLOD = 0;
+	};
+
+	int32 SelectLOD(const FLODSections& Mesh, float ScreenSize) const;
+	void UpdateVisibleLODs(float ScreenSize);
+
+	TArray<FLODSections> MeshSections;
+	int32 CurrentLOD = 0;
+	int32 ForcedLOD = INDEX_NONE;
+};
@@ -7,6 +7,13 @@
 #include "Engine/Texture2D.h"
 #include "RuntimeMeshLoaderHelper.generated.h"
 
+class UDynamicMeshComponent;
+struct FCompactMeshData;
+struct FSceneBufferData;
+namespace UE { namespace Geometry { class FDynamicMesh3; } }
+
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnDynamicMeshLoaded, UDynamicMeshComponent*, DynamicMeshComponent, bool, bSuccess);
+
 /**
  * Helper utility for working with RuntimeMeshLoader
  * Provides simplified functions for common operations
@@ -34,6 +41,124 @@ public:
                                    FVector Scale = FVector(1.0f, 1.0f, 1.0f),
                                    bool bClearMesh = true);
 
+    /**
+     * Same result as LoadMeshWithTextures, but the meshes are converted straight into procedural mesh sections
+     * and installed with SetProcMeshSection, without the FMeshData arrays in between
+     * 
+     * @param ProceduralMeshComponent - The procedural mesh component to populate
+     * @param FilePath - Path to the mesh file (.fbx, .obj, etc.)
+     * @param Type - Whether the path is absolute or relative
+     * @param bClearMesh - Whether to clear the mesh before adding sections
+     * @param bCreateCollision - Whether the sections have collision
+     * @return bool - True if successful
+     */
+    UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|Helper")
+    static bool LoadMeshSectionsWithTextures(UProceduralMeshComponent* ProceduralMeshComponent,
+                                             FString FilePath,
+                                             EPathType Type = EPathType::Absolute,
+                                             bool bClearMesh = true,
+                                             bool bCreateCollision = true);
+
+    /**
+     * Reloads a mesh file into a component that already displays it
+     * If every section still has the same vertex count and index buffer, only the vertex buffers are refreshed
+     * with UpdateMeshSection, which keeps the GPU resources and materials. Collision of the sections is cooked
+     * again once, after all sections were updated. Otherwise the mesh is rebuilt like LoadMeshWithTextures does.
+     * 
+     * @param ProceduralMeshComponent - The procedural mesh component to update
+     * @param FilePath - Path to the mesh file (.fbx, .obj, etc.)
+     * @param Type - Whether the path is absolute or relative
+     * @param bUpdatedInPlace - True if the existing sections were updated in place
+     * @return bool - True if successful
+     */
+    UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|Helper")
+    static bool ReloadMeshWithTextures(UProceduralMeshComponent* ProceduralMeshComponent,
+                                       FString FilePath,
+                                       EPathType Type,
+                                       bool& bUpdatedInPlace);
+
+    /**
+     * Load a mesh from file into a dynamic mesh component (GeometryFramework), with automatic texture loading
+     * Every mesh of the file becomes a material ID / polygroup of one FDynamicMesh3 that can be edited afterwards.
+     * 
+     * @param DynamicMeshComponent - The dynamic mesh component to populate
+     * @param FilePath - Path to the mesh file (.fbx, .obj, etc.)
+     * @param Type - Whether the path is absolute or relative
+     * @param bCreateCollision - Whether to enable complex-as-simple collision
+     * @return bool - True if successful
+     */
+    UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|Helper")
+    static bool LoadMeshIntoDynamicMeshComponent(UDynamicMeshComponent* DynamicMeshComponent,
+                                                 FString FilePath,
+                                                 EPathType Type = EPathType::Absolute,
+                                                 bool bCreateCollision = true);
+
+    /**
+     * Asynchronous version of LoadMeshIntoDynamicMeshComponent
+     * Import and FDynamicMesh3 construction run on a worker thread, the mesh is swapped into the
+     * component with a single SetMesh call on the game thread before OnLoaded fires.
+     */
+    UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|Helper")
+    static void LoadMeshIntoDynamicMeshComponentAsync(UDynamicMeshComponent* DynamicMeshComponent,
+                                                      FString FilePath,
+                                                      EPathType Type,
+                                                      bool bCreateCollision,
+                                                      const FOnDynamicMeshLoaded& OnLoaded);
+
+    /**
+     * Creates a mesh section from compact mesh data, the data is unpacked straight into a temporary procedural mesh section
+     * 
+     * @param ProceduralMeshComponent - The procedural mesh component to add the section to
+     * @param SectionIndex - Index of the section to create or replace
+     * @param MeshData - Mesh in the compact vertex format, see UMeshLoader::LoadCompactMeshFromFile
+     * @param bCreateCollision - Whether the section has collision
+     * @param bUpdateCollision - Cook the collision of the component right away. When creating several sections,
+     *                           pass false and call RebuildCollision once after the last one
+     */
+    static void CreateMeshSectionFromCompact(UProceduralMeshComponent* ProceduralMeshComponent,
+                                             int32 SectionIndex,
+                                             const FCompactMeshData& MeshData,
+                                             bool bCreateCollision = true,
+                                             bool bUpdateCollision = true);
+
+    /**
+     * Creates a mesh section from one mesh of scene buffer data
+     * 
+     * @param ProceduralMeshComponent - The procedural mesh component to add the section to
+     * @param SectionIndex - Index of the section to create or replace
+     * @param SceneData - Scene buffers, see UMeshLoader::LoadSceneBuffersFromFile
+     * @param MeshIndex - Index into SceneData.Meshes
+     * @param bCreateCollision - Whether the section has collision
+     * @param bUpdateCollision - Cook the collision of the component right away, see CreateMeshSectionFromCompact
+     */
+    static void CreateMeshSectionFromSceneBuffers(UProceduralMeshComponent* ProceduralMeshComponent,
+                                                  int32 SectionIndex,
+                                                  const FSceneBufferData& SceneData,
+                                                  int32 MeshIndex,
+                                                  bool bCreateCollision = true,
+                                                  bool bUpdateCollision = true);
+
+    /**
+     * Cooks the collision of all sections with bEnableCollision again, in one go. Needed after sections were
+     * installed with SetProcMeshSection or had their flags changed. Convex collision shapes are kept.
+     */
+    static void RebuildCollision(UProceduralMeshComponent* ProceduralMeshComponent);
+
+    /** Converts loaded mesh data into a dynamic mesh, safe to call from any thread */
+    static void ConvertToDynamicMesh(const FFinalReturnData& ReturnData, UE::Geometry::FDynamicMesh3& OutMesh);
+
+    /**
+     * Loads the <Name>_T.png / <Name>_N.png textures next to a mesh file and creates a material for them
+     *
+     * @param FilePath - Path to the mesh file the textures belong to
+     * @return UMaterialInstanceDynamic* - The created material instance, falls back to a plain grey material
+     */
+    UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|Helper")
+    static UMaterialInstanceDynamic* CreateMaterialForMeshFile(FString FilePath);
+
+    /** Same as above, reports EMeshLoadStage::TextureDecode to OnProgress as each texture is loaded */
+    static UMaterialInstanceDynamic* CreateMaterialForMeshFile(const FString& FilePath, const FOnMeshLoadProgress& OnProgress);
+
     /**
      * Creates a material instance with the texture and normal map
      * 
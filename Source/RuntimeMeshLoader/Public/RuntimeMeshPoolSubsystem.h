@@ -0,0 +1,121 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "ProceduralMeshComponent.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Engine/Texture2D.h"
+#include "RuntimeMeshPoolSubsystem.generated.h"
+
+USTRUCT(BlueprintType)
+struct FRuntimeMeshPoolStats
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "RuntimeMeshPool")
+	int32 ComponentsAcquired = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "RuntimeMeshPool")
+	int32 ComponentsReused = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "RuntimeMeshPool")
+	int32 ComponentsPooled = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "RuntimeMeshPool")
+	int32 MaterialsAcquired = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "RuntimeMeshPool")
+	int32 MaterialsReused = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "RuntimeMeshPool")
+	int32 MaterialsPooled = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "RuntimeMeshPool")
+	int32 TexturesAcquired = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "RuntimeMeshPool")
+	int32 TexturesReused = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "RuntimeMeshPool")
+	int32 TexturesPooled = 0;
+
+	/** Fraction of all acquisitions that were served from the pool (0-1) */
+	UPROPERTY(BlueprintReadOnly, Category = "RuntimeMeshPool")
+	float ReuseRate = 0.0f;
+};
+
+/**
+ * Recycles procedural mesh components, dynamic material instances and transient textures across loads,
+ * so loading and unloading models does not keep feeding the garbage collector.
+ * Objects only return to the pool through the Release functions, objects that are never released
+ * are garbage collected as usual.
+ */
+UCLASS()
+class RUNTIMEMESHLOADER_API URuntimeMeshPoolSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the pool, or null if the engine is not running (e.g. in commandlets) */
+	static URuntimeMeshPoolSubsystem* Get();
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Returns an empty, registered procedural mesh component owned by Owner
+	 *
+	 * @param Owner - Actor the component is added to
+	 * @param AttachParent - Component to attach to, defaults to the root component of Owner
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|Pool")
+	UProceduralMeshComponent* AcquireMeshComponent(AActor* Owner, USceneComponent* AttachParent = nullptr);
+
+	/**
+	 * Clears the component and returns it to the pool, together with the pooled materials and textures it uses
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|Pool")
+	void ReleaseMeshComponent(UProceduralMeshComponent* Component, bool bReleaseMaterials = true);
+
+	/** Returns a dynamic material instance of Parent with all parameter overrides cleared */
+	UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|Pool")
+	UMaterialInstanceDynamic* AcquireMaterialInstance(UMaterialInterface* Parent);
+
+	/** Returns the material instance to the pool, pooled textures it references are released as well */
+	UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|Pool")
+	void ReleaseMaterialInstance(UMaterialInstanceDynamic* MaterialInstance, bool bReleaseTextures = true);
+
+	/** Returns a transient texture with the given size and format, its content is undefined */
+	UTexture2D* AcquireTexture(int32 Width, int32 Height, EPixelFormat Format);
+
+	UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|Pool")
+	void ReleaseTexture(UTexture2D* Texture);
+
+	/** Drops all pooled objects that are not in use, they are garbage collected afterwards */
+	UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|Pool")
+	void TrimPool();
+
+	UFUNCTION(BlueprintPure, Category = "RuntimeMeshLoader|Pool")
+	FRuntimeMeshPoolStats GetStats() const;
+
+	UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|Pool")
+	void ResetStats();
+
+private:
+	/** Forgets handed out objects that were garbage collected without being released */
+	void PruneAcquired();
+
+	UPROPERTY(Transient)
+	TArray<UProceduralMeshComponent*> FreeComponents;
+
+	UPROPERTY(Transient)
+	TArray<UMaterialInstanceDynamic*> FreeMaterials;
+
+	UPROPERTY(Transient)
+	TArray<UTexture2D*> FreeTextures;
+
+	/** Objects handed out by the pool, weak so unreleased objects can still be collected */
+	TSet<TWeakObjectPtr<UMaterialInstanceDynamic>> AcquiredMaterials;
+	TSet<TWeakObjectPtr<UTexture2D>> AcquiredTextures;
+
+	FRuntimeMeshPoolStats Stats;
+};
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Tickable.h"
+#include "MeshLoader.h"
+#include "ProceduralMeshComponent.h"
+#include "RuntimeMeshSectionBuilder.generated.h"
+
+class UMaterialInterface;
+
+USTRUCT(BlueprintType)
+struct FMeshSectionBuildSettings
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** Game thread time in milliseconds the builder may spend per frame. At least one section is created per frame. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "SectionBuilder", meta = (ClampMin = "0.1"))
+	float FrameBudgetMs;
+
+	/** Whether collision is created for the sections. It is cooked once, together with the last section. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "SectionBuilder")
+	bool bCreateCollision;
+
+	/** Cook the collision off the game thread (sets bUseAsyncCooking on the component) */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "SectionBuilder")
+	bool bAsyncCollisionCooking;
+
+	FMeshSectionBuildSettings() : FrameBudgetMs(2.0f), bCreateCollision(true), bAsyncCollisionCooking(true) { }
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnMeshSectionsBuilt, UProceduralMeshComponent*, ProceduralMeshComponent, bool, bSuccess);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnMeshImportProgress, EMeshLoadStage, Stage, float, Progress);
+
+/**
+ * Spreads section creation, material assignment and collision setup of a loaded mesh over several frames
+ * so that large models do not hitch the game thread. OnBuildComplete fires once the whole model is visible.
+ */
+UCLASS(BlueprintType)
+class RUNTIMEMESHLOADER_API URuntimeMeshSectionBuilder : public UObject, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Starts building the sections of already loaded mesh data into a procedural mesh component
+	 *
+	 * @param ProceduralMeshComponent - The procedural mesh component to populate
+	 * @param MeshData - The loaded mesh data, see UMeshLoader::LoadMeshFromFile
+	 * @param Material - Material applied to every section, may be null
+	 * @param Settings - Frame budget and collision settings
+	 * @param bClearMesh - Whether to clear the mesh before adding sections
+	 * @return URuntimeMeshSectionBuilder* - The running builder, bind OnBuildComplete to get notified
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|Builder")
+	static URuntimeMeshSectionBuilder* BuildMeshSections(UProceduralMeshComponent* ProceduralMeshComponent,
+	                                                     const FFinalReturnData& MeshData,
+	                                                     UMaterialInterface* Material,
+	                                                     FMeshSectionBuildSettings Settings,
+	                                                     bool bClearMesh = true);
+
+	/**
+	 * Time-sliced version of URuntimeMeshLoaderHelper::LoadMeshWithTextures. The file is imported on a worker thread,
+	 * afterwards the textures are loaded and the sections are built within the frame budget.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|Builder")
+	static URuntimeMeshSectionBuilder* LoadMeshWithTexturesTimeSliced(UProceduralMeshComponent* ProceduralMeshComponent,
+	                                                                  FString FilePath,
+	                                                                  EPathType Type,
+	                                                                  FMeshSectionBuildSettings Settings,
+	                                                                  bool bClearMesh = true);
+
+	/**
+	 * Stops the build. A running import is cancelled and its memory freed, sections created so far are kept.
+	 * OnBuildComplete fires with bSuccess = false.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RuntimeMeshLoader|Builder")
+	void Cancel();
+
+	UFUNCTION(BlueprintPure, Category = "RuntimeMeshLoader|Builder")
+	bool IsBuilding() const;
+
+	/** Fraction of the mesh sections created so far (0-1) */
+	UFUNCTION(BlueprintPure, Category = "RuntimeMeshLoader|Builder")
+	float GetProgress() const;
+
+	UPROPERTY(BlueprintAssignable, Category = "RuntimeMeshLoader|Builder")
+	FOnMeshSectionsBuilt OnBuildComplete;
+
+	/** Progress of the import stages of LoadMeshWithTexturesTimeSliced, fires on the game thread */
+	UPROPERTY(BlueprintAssignable, Category = "RuntimeMeshLoader|Builder")
+	FOnMeshImportProgress OnImportProgress;
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+private:
+	enum class EBuildPhase : uint8
+	{
+		Idle,
+		Importing,
+		Sections
+	};
+
+	void Begin(UProceduralMeshComponent* ProceduralMeshComponent, const FMeshSectionBuildSettings& InSettings, bool bInClearMesh);
+	void StartSections(FFinalReturnData&& InMeshData, UMaterialInterface* InMaterial);
+	void BuildNextSection();
+	void Finish(bool bSuccess);
+	void BroadcastImportProgress(EMeshLoadStage Stage, float Progress);
+
+	/** Written by the import thread, forwarded to OnImportProgress on tick */
+	struct FImportProgress
+	{
+		std::atomic<EMeshLoadStage> Stage{ EMeshLoadStage::Parse };
+		std::atomic<float> Progress{ 0.0f };
+	};
+
+	UPROPERTY()
+	TWeakObjectPtr<UProceduralMeshComponent> TargetComponent;
+
+	UPROPERTY()
+	UMaterialInterface* Material = nullptr;
+
+	FMeshSectionBuildSettings Settings;
+	FFinalReturnData PendingData;
+
+	TSharedPtr<FMeshLoadCancellationToken> ImportCancellation;
+	TSharedPtr<FImportProgress> ImportProgress;
+	EMeshLoadStage ReportedStage = EMeshLoadStage::Parse;
+	float ReportedProgress = -1.0f;
+
+	/** Node and mesh index of every non-empty mesh, in section order */
+	TArray<TPair<int32, int32>> WorkItems;
+	int32 NextWorkItem = 0;
+	int32 SectionCount = 0;
+	bool bClearMesh = true;
+	EBuildPhase Phase = EBuildPhase::Idle;
+};
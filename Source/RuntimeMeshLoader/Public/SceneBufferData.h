@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MeshLoader.h"
+
+/** Vertex and index range of one mesh in the scene-wide buffers of FSceneBufferData */
+struct FSceneBufferMesh
+{
+	int32 NodeIndex = INDEX_NONE;
+	uint32 FirstVertex = 0;
+	uint32 NumVertices = 0;
+	// Offset into FSceneBufferData::Indices16 if b16BitIndices is set, into FSceneBufferData::Indices otherwise
+	uint32 FirstIndex = 0;
+	uint32 NumIndices = 0;
+	// Set if the mesh has at most 65536 vertices, its indices are relative to FirstVertex so they fit in 16 bits
+	bool b16BitIndices = false;
+	// EMeshAttributes the source mesh had, the buffer ranges of absent attributes hold the CreateMeshSection defaults
+	uint8 Attributes = 0;
+};
+
+struct FSceneBufferNode
+{
+	FTransform RelativeTransform;
+	int32 NodeParentIndex = -1;
+	// Range in FSceneBufferData::Meshes
+	int32 FirstMesh = 0;
+	int32 NumMeshes = 0;
+};
+
+/**
+ * Scene layout of a load in a few contiguous buffers instead of one set of arrays per mesh: all vertices, attributes
+ * and indices of the scene are stored back to back and every mesh refers to its ranges. Indices are relative to the
+ * first vertex of their mesh, so a range can be drawn with that vertex as base vertex. Float precision, LODs are not
+ * carried over.
+ */
+struct RUNTIMEMESHLOADER_API FSceneBufferData
+{
+	bool Success = false;
+
+	TArray<FSceneBufferNode> Nodes;
+	TArray<FSceneBufferMesh> Meshes;
+
+	TArray<FVector3f> Positions;
+	// Attribute buffers are either empty, if no mesh has the attribute, or as long as Positions
+	TArray<FVector3f> Normals;
+	TArray<FVector2f> UVs;
+	// W holds the sign of the binormal (-1 if FProcMeshTangent::bFlipTangentY was set)
+	TArray<FVector4f> Tangents;
+	// Indices of the meshes with b16BitIndices set, and of all others
+	TArray<uint16> Indices16;
+	TArray<uint32> Indices;
+
+	FMeshLoadMemoryReport Memory;
+
+	SIZE_T GetAllocatedSize() const;
+
+	TArrayView<const FVector3f> GetPositions(int32 MeshIndex) const { return MakeArrayView(Positions.GetData() + Meshes[MeshIndex].FirstVertex, Meshes[MeshIndex].NumVertices); }
+	uint32 GetIndex(int32 MeshIndex, int32 Index) const
+	{
+		const FSceneBufferMesh& Mesh = Meshes[MeshIndex];
+		return Mesh.b16BitIndices ? (uint32)Indices16[Mesh.FirstIndex + Index] : Indices[Mesh.FirstIndex + Index];
+	}
+	// Index range of a mesh in the index array it uses, the view into the other one is empty
+	TArrayView<const uint16> GetIndices16(int32 MeshIndex) const { return Meshes[MeshIndex].b16BitIndices ? MakeArrayView(Indices16.GetData() + Meshes[MeshIndex].FirstIndex, Meshes[MeshIndex].NumIndices) : TArrayView<const uint16>(); }
+	TArrayView<const uint32> GetIndices(int32 MeshIndex) const { return Meshes[MeshIndex].b16BitIndices ? TArrayView<const uint32>() : MakeArrayView(Indices.GetData() + Meshes[MeshIndex].FirstIndex, Meshes[MeshIndex].NumIndices); }
+
+	/** Copies one mesh into the arrays CreateMeshSection expects, absent attributes stay empty */
+	void ToMeshData(int32 MeshIndex, FMeshData& OutMesh) const;
+
+	/** Copies one mesh straight into a section for SetProcMeshSection */
+	void ToProcMeshSection(int32 MeshIndex, FProcMeshSection& OutSection) const;
+
+	/**
+	 * Lays out ReturnData in scene-wide buffers. The buffers are sized once up front and filled in parallel,
+	 * each mesh of ReturnData is freed as soon as it is copied.
+	 */
+	static FSceneBufferData FromReturnData(FFinalReturnData&& ReturnData);
+
+	/** Serializes the buffers with one bulk copy each, node and mesh tables element by element */
+	friend RUNTIMEMESHLOADER_API FArchive& operator<<(FArchive& Ar, FSceneBufferData& Data);
+};
@@ -77,7 +77,9 @@ public class RuntimeMeshLoader : ModuleRules
 				"Core",
                 "ProceduralMeshComponent",
                 "RenderCore",
-                "Projects"  // Required for IPluginManager
+                "Projects",  // Required for IPluginManager
+                "GeometryCore",  // FDynamicMesh3
+                "GeometryFramework"  // UDynamicMeshComponent
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -92,10 +94,25 @@ public class RuntimeMeshLoader : ModuleRules
 				"SlateCore",
 				"Projects",
 				"ImageWrapper",
-                "RHI"
+                "RHI",
+                "Json"  // Asset index manifest
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
+
+        // Streaming inflate for reading the start of zipped entries
+        AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
+
+        // IDirectoryWatcher lives in a Developer module, so the asset index only follows file changes where developer tools are built
+        if (Target.bBuildDeveloperTools)
+        {
+            PrivateDependencyModuleNames.Add("DirectoryWatcher");
+            PrivateDefinitions.Add("RUNTIME_MESH_LOADER_WITH_DIRECTORY_WATCHER=1");
+        }
+        else
+        {
+            PrivateDefinitions.Add("RUNTIME_MESH_LOADER_WITH_DIRECTORY_WATCHER=0");
+        }
 		
 		
 		DynamicallyLoadedModuleNames.AddRange(